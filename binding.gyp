@@ -8,6 +8,7 @@
             "include_dirs": ["<!(node -e \"require('nan')\")"],
             "target_name": "binding",
             "sources": ["main.cc"],
+            "conditions": [["OS!='win'", {"libraries": ["-lpthread"]}]],
             "xcode_settings": {
                 "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
                 "CLANG_CXX_LIBRARY": "libc++",
@@ -0,0 +1,139 @@
+#ifndef NUC_INLINE_CACHE_H
+#define NUC_INLINE_CACHE_H
+
+// Nucleus Headers
+#include "../common.h"
+#include "../particle/value.h"
+#include "../utils/memory.h"
+
+/**************************
+ *  INLINE CACHE DEFINES  *
+ **************************/
+
+#define NUC_IC_ENTRIES 4  // shapes remembered by a call site before it turns megamorphic
+
+// forward declaration
+struct nuc_Shape;
+
+/** Denotes what a cache entry resolved to. */
+typedef enum {
+    IC_FIELD,       // entry index is a slot offset of the shape
+    IC_METHOD,      // entry index is an entry of the model methods
+    IC_TRANSITION,  // entry adds a field, moving instances to the target shape
+} nuc_CacheKind;
+
+/** A remembered (shape => member) lookup. */
+typedef struct {
+    struct nuc_Shape* shape;   // shape the lookup was resolved against
+    struct nuc_Shape* target;  // shape transitioned to (transitions only)
+    int index;                 // slot offset / method entry index
+    uint8_t kind;              // what the index refers to
+} nuc_CacheEntry;
+
+/** Nucleus Inline Cache (one per property access / invocation site). */
+typedef struct {
+    nuc_CacheEntry entries[NUC_IC_ENTRIES];  // cached lookups (monomorphic => polymorphic)
+    uint8_t count;                           // cached entries
+    bool megamorphic;                        // site has seen too many shapes to cache
+#ifdef NUC_DEBUG_CACHES
+    uint8_t op;        // operation of the site
+    uint16_t name;     // name constant of the site
+    long line;         // line of the site
+    uint32_t hits;     // lookups served by the cache
+    uint32_t misses;   // lookups that fell back to hashing
+#endif
+} nuc_InlineCache;
+
+/** Array of inline caches owned by a chunk. */
+typedef struct {
+    int count;
+    int capacity;
+    nuc_InlineCache* sites;
+} nuc_CacheArr;
+
+/*****************************
+ *  INLINE CACHE STATISTICS  *
+ *****************************/
+
+#ifdef NUC_DEBUG_CACHES
+    #define IC_HIT(cache) ((cache)->hits++)
+    #define IC_MISS(cache) ((cache)->misses++)
+#else
+    #define IC_HIT(cache)
+    #define IC_MISS(cache)
+#endif
+
+/**************************
+ *  INLINE CACHE METHODS  *
+ **************************/
+
+/**
+ * Initialises an inline cache array.
+ * @param arr                   Array to initialise.
+ */
+static inline void cacheArr_init(nuc_CacheArr* arr) {
+    arr->count = 0;
+    arr->capacity = 0;
+    arr->sites = NULL;
+}
+
+/**
+ * Frees an inline cache array.
+ * @param arr                   Array to free.
+ */
+static inline void cacheArr_free(nuc_CacheArr* arr) {
+    NUC_FREE_ARR(nuc_InlineCache, arr->sites, arr->capacity);
+    cacheArr_init(arr);
+}
+
+/**
+ * Adds an empty inline cache to an array.
+ * @param arr                   Array to add to.
+ * @param op                    Operation of the site.
+ * @param name                  Name constant of the site.
+ * @param line                  Line of the site.
+ * @returns                     Index of the new cache.
+ */
+static inline int cacheArr_add(nuc_CacheArr* arr, uint8_t op, uint16_t name, long line) {
+    NUC_GROW_ARR_IF(nuc_InlineCache, arr, sites, GROW_FAST);
+    nuc_InlineCache* cache = &arr->sites[arr->count];
+    cache->count = 0;
+    cache->megamorphic = false;
+#ifdef NUC_DEBUG_CACHES
+    cache->op = op;
+    cache->name = name;
+    cache->line = line;
+    cache->hits = 0;
+    cache->misses = 0;
+#else
+    (void)op, (void)name, (void)line;
+#endif
+    return arr->count++;
+}
+
+/**
+ * Remembers a resolved lookup in an inline cache. Sites that have already seen `NUC_IC_ENTRIES`
+ * shapes turn megamorphic and are no longer updated.
+ * @param cache                 Cache to update.
+ * @param entry                 Resolved lookup.
+ */
+static inline void cache_update(nuc_InlineCache* cache, nuc_CacheEntry entry) {
+    if (cache->megamorphic) return;
+
+    // refresh a stale entry of the same shape first
+    for (int i = 0; i < cache->count; i++) {
+        if (cache->entries[i].shape == entry.shape) {
+            cache->entries[i] = entry;
+            return;
+        }
+    }
+
+    // otherwise extend the cache (or give up on the site)
+    if (cache->count == NUC_IC_ENTRIES) {
+        cache->megamorphic = true;
+        return;
+    }
+    cache->entries[cache->count++] = entry;
+}
+
+#endif
@@ -8,6 +8,8 @@
 #include "../common.h"
 #include "../particle/value.h"
 #include "../utils/memory.h"
+#include "cache.h"
+#include "lines.h"
 
 // forward declaration
 static inline void atomizer_push(nuc_Particle value);
@@ -20,12 +22,17 @@ static inline nuc_Particle atomizer_pop();
 /** Nucleus Bytecode Chunks */
 typedef struct {
     int count;                  // array based
-    int capacity;               // items
-    uint8_t* code;              // bytecode
-    long* lines;                // lines connected to bytecode
+    int capacity;               // items (within the code arena whilst compiling)
+    uint8_t* code;              // bytecode (owned by the code arena / a code segment / a bytecode image)
+    nuc_LineTable lines;        // lines connected to bytecode
     nuc_ParticleArr constants;  // chunk constants
+    nuc_CacheArr caches;        // inline caches of property / invoke sites
+    bool shared;                // lines point into a code segment / bytecode image (so are not freed)
 } nuc_Chunk;
 
+// forward declaration
+static void fuser_reserveCode(nuc_Chunk* chunk, int count);
+
 /*******************
  *  CHUNK METHODS  *
  *******************/
@@ -38,8 +45,10 @@ void chunk_init(nuc_Chunk* chunk) {
     chunk->count = 0;
     chunk->capacity = 0;
     chunk->code = NULL;
-    chunk->lines = NULL;
+    lineTable_init(&chunk->lines);
     particleArr_init(&chunk->constants);
+    cacheArr_init(&chunk->caches);
+    chunk->shared = false;
 }
 
 /**
@@ -47,21 +56,21 @@ void chunk_init(nuc_Chunk* chunk) {
  * @param chunk                 Chunk to free from memory.
  */
 void chunk_free(nuc_Chunk* chunk) {
-    NUC_FREE_ARR(uint8_t, chunk->code, chunk->capacity);
-    NUC_FREE_ARR(long, chunk->lines, chunk->capacity);
+    if (!chunk->shared) lineTable_free(&chunk->lines);
     particleArr_free(&chunk->constants);
+    cacheArr_free(&chunk->caches);
     chunk_init(chunk);  // and re-initialise to default
 }
 
 /**
- * Writes a byte to a chunk. If there is no space, the chunk size is increased.
+ * Writes a byte to a chunk. If there is no space, more of the code arena is reserved.
  * @param chunk                 Chunk to write to.
  * @param byte                  Byte to write.
  */
 void chunk_write(nuc_Chunk* chunk, uint8_t byte, long line) {
-    NUC_GROW_ARR_IF_MULT(uint8_t, long, chunk, code, lines, GROW_FAST);  // grow if space is needed
-    chunk->code[chunk->count] = byte;                                    // write byte
-    chunk->lines[chunk->count] = line;                                   // and the associate line
+    if (chunk->capacity < chunk->count + 1) fuser_reserveCode(chunk, chunk->count + 1);
+    chunk->code[chunk->count] = byte;                  // write byte
+    lineTable_add(&chunk->lines, chunk->count, line);  // and the associate line
     chunk->count++;
 }
 
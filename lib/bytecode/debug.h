@@ -8,10 +8,14 @@
 #include "../particle/print.h"
 #include "chunk.h"
 #include "ops.h"
+#include "registers.h"
 
 // operation padding length
 #define PRINT_OP_PAD_LEN 34
 
+// FORWARD DECLARATIONS
+static const char* atomizer_nativeName(int index);
+
 /**
  * Prints a jump instruction.
  * @param name              Name of instruction.
@@ -52,6 +56,39 @@ static int nuc_printConstantInstruction(const char* name, nuc_Chunk* chunk, int
     return offset + 3;
 }
 
+/**
+ * Prints a global slot instruction.
+ * @param name                  Name of instruction.
+ * @param chunk                 Chunk of global instruction.
+ * @param offset                Current offset.
+ */
+static int nuc_printGlobalInstruction(const char* name, nuc_Chunk* chunk, int offset) {
+    uint16_t slot = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+    printf("%-*s \x1b[2;33m%4d\x1b[0m \x1b[2m|\x1b[0m ", PRINT_OP_PAD_LEN, name, slot);
+    particle_print(atomizer.globalNames.values[slot], true);
+    printf("\n");
+    return offset + 3;
+}
+
+/**
+ * Prints a native instruction (optionally followed by an argument count).
+ * @param name                  Name of instruction.
+ * @param chunk                 Chunk of native instruction.
+ * @param offset                Current offset.
+ * @param isCall                Denotes a direct native call.
+ */
+static int nuc_printNativeInstruction(const char* name, nuc_Chunk* chunk, int offset, bool isCall) {
+    uint16_t native = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+    printf("%-*s \x1b[2;33m%4d\x1b[0m \x1b[2m|\x1b[0m \x1b[36m%s\x1b[0m", PRINT_OP_PAD_LEN, name, native, atomizer_nativeName(native));
+    if (!isCall) {
+        printf("\n");
+        return offset + 3;
+    }
+
+    printf(" : (\x1b[33m%d\x1b[0m args)\n", chunk->code[offset + 3]);
+    return offset + 4;
+}
+
 /**
  * Prints a byte instruction.
  * @param name                  Name of instruction.
@@ -91,6 +128,106 @@ static int nuc_printInvokeInstruction(const char* name, nuc_Chunk* chunk, int of
     return offset + 4;
 }
 
+/**
+ * Prints a property instruction along with its inline cache.
+ * @param name                  Name of instruction.
+ * @param chunk                 Chunk of property instruction.
+ * @param offset                Current offset.
+ */
+static int nuc_printCachedInstruction(const char* name, nuc_Chunk* chunk, int offset) {
+    uint16_t constant = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+    uint16_t cache = (uint16_t)(chunk->code[offset + 3] << 8) | chunk->code[offset + 4];
+    printf("%-*s \x1b[2;33m%4d\x1b[0m \x1b[2m|\x1b[0m ", PRINT_OP_PAD_LEN, name, constant);
+    particle_print(chunk->constants.values[constant], true);
+    printf(" \x1b[2m(ic %d)\x1b[0m\n", cache);
+    return offset + 5;
+}
+
+/**
+ * Prints a cached invoke instruction.
+ * @param name                  Name of instruction.
+ * @param chunk                 Chunk of invoke instruction.
+ * @param offset                Current offset.
+ */
+static int nuc_printCachedInvokeInstruction(const char* name, nuc_Chunk* chunk, int offset) {
+    uint16_t constant = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+    uint8_t argCount = chunk->code[offset + 3];
+    uint16_t cache = (uint16_t)(chunk->code[offset + 4] << 8) | chunk->code[offset + 5];
+    printf("%-*s \x1b[2;33m%4d\x1b[0m \x1b[2m|\x1b[0m ", PRINT_OP_PAD_LEN, name, constant);
+    particle_print(chunk->constants.values[constant], true);
+    printf(" : (\x1b[33m%d\x1b[0m args) \x1b[2m(ic %d)\x1b[0m\n", argCount, cache);
+    return offset + 6;
+}
+
+/**
+ * Prints a fused local / constant instruction.
+ * @param name                  Name of instruction.
+ * @param chunk                 Chunk of fused instruction.
+ * @param offset                Current offset.
+ */
+static int nuc_printLocalConstantInstruction(const char* name, nuc_Chunk* chunk, int offset) {
+    uint16_t slot = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+    uint16_t constant = (uint16_t)(chunk->code[offset + 3] << 8) | chunk->code[offset + 4];
+    printf("%-*s \x1b[2;33m%4d\x1b[0m \x1b[2m,\x1b[0m \x1b[2;33m%d\x1b[0m \x1b[2m|\x1b[0m ", PRINT_OP_PAD_LEN, name, slot, constant);
+    particle_print(chunk->constants.values[constant], true);
+
+    // and display any trailing operands
+    switch (chunk->code[offset]) {
+        case OP_SUB_LOCAL_CONST_CALL:
+            printf(" : (\x1b[33m%d\x1b[0m args)\n", chunk->code[offset + 5]);
+            return offset + 6;
+
+        case OP_LOCAL_LT_CONST_JUMP: {
+            uint32_t jump = (uint32_t)(chunk->code[offset + 5] << 24);
+            jump |= (uint32_t)(chunk->code[offset + 6] << 16);
+            jump |= (uint32_t)(chunk->code[offset + 7] << 8);
+            jump |= chunk->code[offset + 8];
+            printf(" \x1b[2m>\x1b[0m \x1b[33m%.4X\n\x1b[0m", offset + 9 + jump);
+            return offset + 9;
+        }
+
+        default:
+            printf("\n");
+            return offset + 5;
+    }
+}
+
+/**
+ * Prints a fused two local instruction.
+ * @param name                  Name of instruction.
+ * @param chunk                 Chunk of fused instruction.
+ * @param offset                Current offset.
+ */
+static int nuc_printLocalsInstruction(const char* name, nuc_Chunk* chunk, int offset) {
+    uint16_t a = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+    uint16_t b = (uint16_t)(chunk->code[offset + 3] << 8) | chunk->code[offset + 4];
+    printf("%-*s \x1b[2;33m%4d\x1b[0m \x1b[2m,\x1b[0m \x1b[2;33m%d\x1b[0m\n", PRINT_OP_PAD_LEN, name, a, b);
+    return offset + 5;
+}
+
+/**
+ * Prints a numeric range loop instruction (variable, limit and step locals, and the jump target).
+ * @param name                  Name of instruction.
+ * @param chunk                 Chunk of loop instruction.
+ * @param offset                Current offset.
+ */
+static int nuc_printForInstruction(const char* name, nuc_Chunk* chunk, int offset) {
+    bool isLoop = chunk->code[offset] == OP_FOR_NUM_LOOP;
+    int length = isLoop ? 11 : 9;
+    uint16_t variable = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+    uint16_t limit = (uint16_t)(chunk->code[offset + 3] << 8) | chunk->code[offset + 4];
+    printf("%-*s \x1b[2;33m%4d\x1b[0m \x1b[2m,\x1b[0m \x1b[2;33m%d\x1b[0m", PRINT_OP_PAD_LEN, name, variable, limit);
+    if (isLoop) printf(" \x1b[2m,\x1b[0m \x1b[2;33m%d\x1b[0m", (uint16_t)(chunk->code[offset + 5] << 8) | chunk->code[offset + 6]);
+
+    // and the jump target
+    uint32_t jump = (uint32_t)(chunk->code[offset + length - 4] << 24);
+    jump |= (uint32_t)(chunk->code[offset + length - 3] << 16);
+    jump |= (uint32_t)(chunk->code[offset + length - 2] << 8);
+    jump |= chunk->code[offset + length - 1];
+    printf(" \x1b[2m>\x1b[0m \x1b[33m%.4X\n\x1b[0m", offset + length + (isLoop ? -1 : 1) * (int)jump);
+    return offset + length;
+}
+
 /**
  * Disassembles a given chunk instruction at set offset.
  * @param chunk                     Chunk to disassemble instruction of.
@@ -101,10 +238,11 @@ int nuc_disassembleInstruction(nuc_Chunk* chunk, int offset, const char* prompt)
     printf("%s  \x1b[2;33m%04X\x1b[0m ", prompt, offset);  // print the offset
 
     // want to also add some line information
-    if (offset > 0 && chunk->lines[offset] == chunk->lines[offset - 1]) {
+    long line = lineTable_get(&chunk->lines, offset);
+    if (offset > 0 && line == lineTable_get(&chunk->lines, offset - 1)) {
         printf("       \x1b[2m|\x1b[0m ");
     } else {
-        printf("  \x1b[33m%4ld\x1b[0m \x1b[2m|\x1b[0m ", chunk->lines[offset]);
+        printf("  \x1b[33m%4ld\x1b[0m \x1b[2m|\x1b[0m ", line);
     }
 
 /** Displays a CONSTANT Case instruction */
@@ -112,6 +250,11 @@ int nuc_disassembleInstruction(nuc_Chunk* chunk, int offset, const char* prompt)
     case op:                    \
         return nuc_printConstantInstruction(name, chunk, offset)
 
+/** Displays a GLOBAL slot Case instruction */
+#define CASE_GLOBAL(op, name) \
+    case op:                  \
+        return nuc_printGlobalInstruction(name, chunk, offset)
+
 /** Displays a SIMPLE Case instruction */
 #define CASE_SIMPLE(op, name) \
     case op:                  \
@@ -135,6 +278,30 @@ int nuc_disassembleInstruction(nuc_Chunk* chunk, int offset, const char* prompt)
     case op:                  \
         return nuc_printInvokeInstruction(name, chunk, offset)
 
+/** Displays a CACHED property instruction */
+#define CASE_CACHED(op, name) \
+    case op:                  \
+        return nuc_printCachedInstruction(name, chunk, offset)
+
+#define CASE_CACHED_INVOKE(op, name) \
+    case op:                         \
+        return nuc_printCachedInvokeInstruction(name, chunk, offset)
+
+/** Displays a FUSED local / constant instruction */
+#define CASE_FUSED(op, name) \
+    case op:                 \
+        return nuc_printLocalConstantInstruction(name, chunk, offset)
+
+/** Displays a FUSED two local instruction */
+#define CASE_LOCALS(op, name) \
+    case op:                  \
+        return nuc_printLocalsInstruction(name, chunk, offset)
+
+/** Displays a numeric range loop Case instruction */
+#define CASE_FOR(op, name) \
+    case op:               \
+        return nuc_printForInstruction(name, chunk, offset)
+
     // and now print the instruction
     uint8_t inst = chunk->code[offset];
     switch (inst) {
@@ -167,9 +334,9 @@ int nuc_disassembleInstruction(nuc_Chunk* chunk, int offset, const char* prompt)
         CASE_SIMPLE(OP_POP, "\x1b[34mOP_POP\x1b[0m");
         CASE_SIMPLE(OP_CATCH_MODE, "\x1b[3;33mOP_CATCH_MODE\x1b[0m");
         CASE_SIMPLE(OP_END_CATCH_MODE, "\x1b[3;33mOP_END_CATCH_MODE\x1b[0m");
-        CASE_CONSTANT(OP_DEFINE_GLOBAL, "\x1b[34mOP_DEFINE_GLOBAL\x1b[0m");
-        CASE_CONSTANT(OP_GET_GLOBAL, "\x1b[34mOP_GET_GLOBAL\x1b[0m");
-        CASE_CONSTANT(OP_SET_GLOBAL, "\x1b[34mOP_SET_GLOBAL\x1b[0m");
+        CASE_GLOBAL(OP_DEFINE_GLOBAL_SLOT, "\x1b[34mOP_DEFINE_GLOBAL_SLOT\x1b[0m");
+        CASE_GLOBAL(OP_GET_GLOBAL_SLOT, "\x1b[34mOP_GET_GLOBAL_SLOT\x1b[0m");
+        CASE_GLOBAL(OP_SET_GLOBAL_SLOT, "\x1b[34mOP_SET_GLOBAL_SLOT\x1b[0m");
         CASE_SHORT(OP_GET_LOCAL, "\x1b[34mOP_GET_LOCAL\x1b[0m");
         CASE_SHORT(OP_SET_LOCAL, "\x1b[34mOP_SET_LOCAL\x1b[0m");
         CASE_SHORT(OP_GET_UPVALUE, "\x1b[34mOP_GET_UPVALUE\x1b[0m");
@@ -178,18 +345,18 @@ int nuc_disassembleInstruction(nuc_Chunk* chunk, int offset, const char* prompt)
 
         /** Array Operations */
         CASE_CONSTANT(OP_ARRAY, "\x1b[3mOP_ARRAY\x1b[0m");
-        CASE_BYTE(OP_GET_MEMBER, "\x1b[3mOP_GET_MEMBER\x1b[0m");
-        CASE_BYTE(OP_SET_MEMBER, "\x1b[3mOP_SET_MEMBER\x1b[0m");
+        CASE_SIMPLE(OP_GET_MEMBER, "\x1b[3mOP_GET_MEMBER\x1b[0m");
+        CASE_SIMPLE(OP_SET_MEMBER, "\x1b[3mOP_SET_MEMBER\x1b[0m");
 
         /** Model Operations */
         CASE_CONSTANT(OP_MODEL, "\x1b[33mOP_MODEL\x1b[0m");
         CASE_SIMPLE(OP_INHERIT, "\x1b[33mOP_INHERIT\x1b[33m");
         CASE_CONSTANT(OP_METHOD, "\x1b[33mOP_METHOD\x1b[0m");
-        CASE_INVOKE(OP_INVOKE, "\x1b[33mOP_INVOKE\x1b[0m");
+        CASE_CACHED_INVOKE(OP_INVOKE, "\x1b[33mOP_INVOKE\x1b[0m");
         CASE_CONSTANT(OP_FIELD, "\x1b[33mOP_FIELD\x1b[0m");
-        CASE_CONSTANT(OP_GET_PROPERTY, "\x1b[33mOP_GET_PROPERTY\x1b[0m");
-        CASE_CONSTANT(OP_SET_PROPERTY, "\x1b[33mOP_SET_PROPERTY\x1b[0m");
-        CASE_CONSTANT(OP_SET_BASE_PROPERTY, "\x1b[33mOP_SET_BASE_PROPERTY\x1b[0m");
+        CASE_CACHED(OP_GET_PROPERTY, "\x1b[33mOP_GET_PROPERTY\x1b[0m");
+        CASE_CACHED(OP_SET_PROPERTY, "\x1b[33mOP_SET_PROPERTY\x1b[0m");
+        CASE_CACHED(OP_SET_BASE_PROPERTY, "\x1b[33mOP_SET_BASE_PROPERTY\x1b[0m");
         CASE_CONSTANT(OP_GET_SUPER, "\x1b[33mOP_GET_SUPER\x1b[0m");
         CASE_INVOKE(OP_SUPER_INVOKE, "\x1b[33mOP_SUPER_INVOKE\x1b[0m");
 
@@ -197,16 +364,31 @@ int nuc_disassembleInstruction(nuc_Chunk* chunk, int offset, const char* prompt)
         CASE_BYTE(OP_MUTATE, "\x1b[35mOP_MUTATE\x1b[0m");
 
         /** Library Operations */
-        CASE_CONSTANT(OP_GET_NATIVE, "\x1b[34mOP_GET_NATIVE\x1b[0m");
+        case OP_GET_NATIVE:
+            return nuc_printNativeInstruction("\x1b[34mOP_GET_NATIVE\x1b[0m", chunk, offset, false);
+        case OP_CALL_NATIVE:
+            return nuc_printNativeInstruction("\x1b[31mOP_CALL_NATIVE\x1b[0m", chunk, offset, true);
+        case OP_CALL_NATIVE_NUM:
+            return nuc_printNativeInstruction("\x1b[31mOP_CALL_NATIVE_NUM\x1b[0m", chunk, offset, true);
 
         /** Control Operations */
         CASE_SIMPLE(OP_RETURN, "\x1b[3;31mOP_RETURN\x1b[0m");
         CASE_JUMP(OP_JUMP, "\x1b[31mOP_JUMP\x1b[0m");
         CASE_JUMP(OP_JUMP_IF_FALSE, "\x1b[31mOP_JUMP_IF_FALSE\x1b[0m");
         CASE_JUMP(OP_JUMP_IF_FALSE_OR_POP, "\x1b[31mOP_JUMP_IF_FALSE_OR_POP\x1b[0m");
+        CASE_JUMP(OP_POP_JUMP_IF_FALSE, "\x1b[31mOP_POP_JUMP_IF_FALSE\x1b[0m");
         CASE_JUMP(OP_JUMP_CATCH, "\x1b[31mOP_JUMP_CATCH\x1b[0m");
         CASE_JUMP(OP_LOOP, "\x1b[31mOP_LOOP\x1b[0m");
+        CASE_FOR(OP_FOR_NUM_PREP, "\x1b[31mOP_FOR_NUM_PREP\x1b[0m");
+        CASE_FOR(OP_FOR_NUM_LOOP, "\x1b[31mOP_FOR_NUM_LOOP\x1b[0m");
         CASE_BYTE(OP_CALL, "\x1b[31mOP_CALL\x1b[0m");
+
+        /** Fused Operations */
+        CASE_FUSED(OP_LOCAL_LT_CONST_JUMP, "\x1b[36mOP_LOCAL_LT_CONST_JUMP\x1b[0m");
+        CASE_FUSED(OP_SUB_LOCAL_CONST, "\x1b[36mOP_SUB_LOCAL_CONST\x1b[0m");
+        CASE_FUSED(OP_SUB_LOCAL_CONST_CALL, "\x1b[36mOP_SUB_LOCAL_CONST_CALL\x1b[0m");
+        CASE_LOCALS(OP_ADD_LOCALS, "\x1b[36mOP_ADD_LOCALS\x1b[0m");
+
         case OP_CLOSURE: {  // this one requires some 'special' attention
             offset++;
             uint16_t constant = (uint16_t)(chunk->code[offset] << 8) | chunk->code[offset + 1];
@@ -234,8 +416,17 @@ int nuc_disassembleInstruction(nuc_Chunk* chunk, int offset, const char* prompt)
 
         // undefine some local macros
 #undef CASE_CONSTANT
+#undef CASE_GLOBAL
 #undef CASE_SIMPLE
 #undef CASE_BYTE
+#undef CASE_SHORT
+#undef CASE_JUMP
+#undef CASE_INVOKE
+#undef CASE_CACHED
+#undef CASE_CACHED_INVOKE
+#undef CASE_FUSED
+#undef CASE_LOCALS
+#undef CASE_FOR
 }
 
 /**
@@ -271,4 +462,161 @@ void nuc_disassembleChunk(nuc_Chunk* chunk, const char* name) {
     nuc_printChunkRaw(chunk);
 }
 
-#endif
\ No newline at end of file
+/**************************
+ *  REGISTER DISASSEMBLY  *
+ **************************/
+
+// register operation display names
+static const char* __regOpNames[] = {
+    [ROP_MOVE] = "ROP_MOVE",
+    [ROP_LOADK] = "ROP_LOADK",
+    [ROP_LOADNULL] = "ROP_LOADNULL",
+    [ROP_LOADTRUE] = "ROP_LOADTRUE",
+    [ROP_LOADFALSE] = "ROP_LOADFALSE",
+    [ROP_ADD] = "ROP_ADD",
+    [ROP_SUB] = "ROP_SUB",
+    [ROP_MUL] = "ROP_MUL",
+    [ROP_DIV] = "ROP_DIV",
+    [ROP_MOD] = "ROP_MOD",
+    [ROP_POW] = "ROP_POW",
+    [ROP_XOR] = "ROP_XOR",
+    [ROP_BITW_OR] = "ROP_BITW_OR",
+    [ROP_BITW_AND] = "ROP_BITW_AND",
+    [ROP_ROL] = "ROP_ROL",
+    [ROP_ROR] = "ROP_ROR",
+    [ROP_ADDK] = "ROP_ADDK",
+    [ROP_SUBK] = "ROP_SUBK",
+    [ROP_MULK] = "ROP_MULK",
+    [ROP_DIVK] = "ROP_DIVK",
+    [ROP_NEGATE] = "ROP_NEGATE",
+    [ROP_BITW_NOT] = "ROP_BITW_NOT",
+    [ROP_NOT] = "ROP_NOT",
+    [ROP_EQUAL] = "ROP_EQUAL",
+    [ROP_LESS] = "ROP_LESS",
+    [ROP_GREATER] = "ROP_GREATER",
+    [ROP_LESSK] = "ROP_LESSK",
+    [ROP_JUMP] = "ROP_JUMP",
+    [ROP_JUMP_IF_FALSE] = "ROP_JUMP_IF_FALSE",
+    [ROP_LESS_JUMP] = "ROP_LESS_JUMP",
+    [ROP_LESSK_JUMP] = "ROP_LESSK_JUMP",
+    [ROP_FOR_NUM_PREP] = "ROP_FOR_NUM_PREP",
+    [ROP_FOR_NUM_LOOP] = "ROP_FOR_NUM_LOOP",
+    [ROP_DEFINE_GLOBAL] = "ROP_DEFINE_GLOBAL",
+    [ROP_GET_GLOBAL] = "ROP_GET_GLOBAL",
+    [ROP_SET_GLOBAL] = "ROP_SET_GLOBAL",
+    [ROP_GET_UPVALUE] = "ROP_GET_UPVALUE",
+    [ROP_SET_UPVALUE] = "ROP_SET_UPVALUE",
+    [ROP_CLOSE_UPVALUE] = "ROP_CLOSE_UPVALUE",
+    [ROP_GET_NATIVE] = "ROP_GET_NATIVE",
+    [ROP_CALL] = "ROP_CALL",
+    [ROP_CALL_NATIVE] = "ROP_CALL_NATIVE",
+    [ROP_CALL_NATIVE_NUM] = "ROP_CALL_NATIVE_NUM",
+    [ROP_CLOSURE] = "ROP_CLOSURE",
+    [ROP_ARRAY] = "ROP_ARRAY",
+    [ROP_RETURN] = "ROP_RETURN",
+};
+
+/**
+ * Disassembles a register chunk instruction at a set offset.
+ * @param regs                      Register chunk to disassemble instruction of.
+ * @param chunk                     Stack chunk holding the constants.
+ * @param offset                    Offset of instruction.
+ */
+static int nuc_disassembleRegisterInstruction(nuc_RegChunk* regs, nuc_Chunk* chunk, int offset) {
+    uint32_t word = regs->code[offset];
+    printf("[\x1b[2;35mregs\x1b[0m]  \x1b[2;33m%04X\x1b[0m   \x1b[33m%4ld\x1b[0m \x1b[2m|\x1b[0m ", offset, lineTable_get(&regs->lines, offset));
+    printf("%-*s ", PRINT_OP_PAD_LEN, __regOpNames[NUC_REG_OP(word)]);
+
+    switch (NUC_REG_OP(word)) {
+        case ROP_JUMP:
+        case ROP_JUMP_IF_FALSE:
+        case ROP_LESS_JUMP:
+        case ROP_LESSK_JUMP:
+        case ROP_FOR_NUM_PREP:
+        case ROP_FOR_NUM_LOOP:  // jumps are followed by an offset word
+            printf("%3d %3d %3d \x1b[2m>\x1b[0m \x1b[33m%.4X\x1b[0m\n", NUC_REG_A(word), NUC_REG_B(word), NUC_REG_C(word), offset + 2 + (int32_t)regs->code[offset + 1]);
+            return offset + 2;
+
+        case ROP_LOADK:
+            printf("%3d %7d \x1b[2m|\x1b[0m ", NUC_REG_A(word), NUC_REG_BX(word));
+            particle_print(chunk->constants.values[NUC_REG_BX(word)], true);
+            printf("\n");
+            return offset + 1;
+
+        case ROP_DEFINE_GLOBAL:
+        case ROP_GET_GLOBAL:
+        case ROP_SET_GLOBAL:
+            printf("%3d %7d \x1b[2m|\x1b[0m ", NUC_REG_A(word), NUC_REG_BX(word));
+            particle_print(atomizer.globalNames.values[NUC_REG_BX(word)], true);
+            printf("\n");
+            return offset + 1;
+
+        case ROP_GET_NATIVE:
+            printf("%3d %7d \x1b[2m|\x1b[0m \x1b[36m%s\x1b[0m\n", NUC_REG_A(word), NUC_REG_BX(word), atomizer_nativeName(NUC_REG_BX(word)));
+            return offset + 1;
+
+        case ROP_CALL_NATIVE:
+        case ROP_CALL_NATIVE_NUM:
+            printf("%3d %3d %3d \x1b[2m|\x1b[0m \x1b[36m%s\x1b[0m\n", NUC_REG_A(word), NUC_REG_B(word), NUC_REG_C(word), atomizer_nativeName(NUC_REG_C(word)));
+            return offset + 1;
+
+        case ROP_CLOSURE:  // closures are followed by a word per captured upvalue
+            printf("%3d %7d\n", NUC_REG_A(word), NUC_REG_BX(word));
+            return offset + 1 + AS_REACTION(chunk->constants.values[NUC_REG_BX(word)])->uvCount;
+
+        case ROP_GET_UPVALUE:
+        case ROP_SET_UPVALUE:
+        case ROP_ARRAY:
+            printf("%3d %7d\n", NUC_REG_A(word), NUC_REG_BX(word));
+            return offset + 1;
+
+        default:
+            printf("%3d %3d %3d\n", NUC_REG_A(word), NUC_REG_B(word), NUC_REG_C(word));
+            return offset + 1;
+    }
+}
+
+/**
+ * Disassembles a given register chunk with display name.
+ * @param regs                      Register chunk to disassemble.
+ * @param chunk                     Stack chunk holding the constants.
+ * @param name                      Display name.
+ */
+void nuc_disassembleRegisters(nuc_RegChunk* regs, nuc_Chunk* chunk, const char* name) {
+    printf("\n[\x1b[2;35mregs\x1b[0m]  \x1b[35m\"%s\"\x1b[0m (%d registers)\n", name, regs->frameSize);
+    for (int offset = 0; offset < regs->count;) offset = nuc_disassembleRegisterInstruction(regs, chunk, offset);
+    printf("\n");  // and pad display
+}
+
+/*****************************
+ *  INLINE CACHE STATISTICS  *
+ *****************************/
+
+#ifdef NUC_DEBUG_CACHES
+/**
+ * Displays the hit / miss counts and state of every inline cache in a chunk.
+ * @param chunk                     Chunk owning the caches.
+ * @param name                      Display name.
+ */
+void nuc_printCaches(nuc_Chunk* chunk, const char* name) {
+    for (int i = 0; i < chunk->caches.count; i++) {
+        nuc_InlineCache* cache = &chunk->caches.sites[i];
+        const char* op = cache->op == OP_INVOKE             ? "OP_INVOKE"
+                         : cache->op == OP_GET_PROPERTY     ? "OP_GET_PROPERTY"
+                         : cache->op == OP_SET_PROPERTY     ? "OP_SET_PROPERTY"
+                                                            : "OP_SET_BASE_PROPERTY";
+        const char* state = cache->megamorphic ? "megamorphic"
+                            : cache->count > 1 ? "polymorphic"
+                            : cache->count == 1 ? "monomorphic"
+                                                : "uninitialised";
+
+        // display the site and its counts
+        printf("[\x1b[2;36mcache\x1b[0m]  \x1b[35m%s\x1b[0m:\x1b[33m%ld\x1b[0m %-22s ", name, cache->line, op);
+        particle_print(chunk->constants.values[cache->name], true);
+        printf(" \x1b[2m|\x1b[0m hits \x1b[32m%u\x1b[0m misses \x1b[31m%u\x1b[0m \x1b[2m(%s, %d shapes)\x1b[0m\n",
+               cache->hits, cache->misses, state, cache->count);
+    }
+}
+#endif
+
+#endif
@@ -0,0 +1,126 @@
+#ifndef NUC_LINES_H
+#define NUC_LINES_H
+
+// Nucleus Headers
+#include "../common.h"
+#include "../utils/memory.h"
+
+/************************
+ *  LINE TABLE DEFINES  *
+ ************************/
+
+/** A run of bytecode that was compiled from a single line. */
+typedef struct {
+    int offset;  // offset the run starts at
+    int line;    // line of the run
+} nuc_LineRun;
+
+/**
+ * Run-length encoded lines of a chunk. A new run is only started when the line changes, so most
+ * statements only cost a single run (rather than a line per byte of code).
+ */
+typedef struct {
+    int count;
+    int capacity;
+    nuc_LineRun* runs;
+} nuc_LineTable;
+
+/** Forwards-walking position within a line table (for passes that walk a chunk in order). */
+typedef struct {
+    const nuc_LineTable* table;
+    int run;
+} nuc_LineCursor;
+
+/************************
+ *  LINE TABLE METHODS  *
+ ************************/
+
+/**
+ * Initialises a line table.
+ * @param table                 Table to initialise.
+ */
+static inline void lineTable_init(nuc_LineTable* table) {
+    table->count = 0;
+    table->capacity = 0;
+    table->runs = NULL;
+}
+
+/**
+ * Frees a line table.
+ * @param table                 Table to free.
+ */
+static inline void lineTable_free(nuc_LineTable* table) {
+    NUC_FREE_ARR(nuc_LineRun, table->runs, table->capacity);
+    lineTable_init(table);
+}
+
+/**
+ * Associates a line with the code written at an offset (always the end of the chunk).
+ * @param table                 Table to add to.
+ * @param offset                Offset of the code.
+ * @param line                  Line of the code.
+ */
+static inline void lineTable_add(nuc_LineTable* table, int offset, long line) {
+    if (table->count > 0 && table->runs[table->count - 1].line == line) return;
+    NUC_GROW_ARR_IF(nuc_LineRun, table, runs, GROW_FAST);
+    table->runs[table->count++] = (nuc_LineRun){offset, (int)line};
+}
+
+/**
+ * Drops the lines of the code from an offset onwards (for when the code is truncated).
+ * @param table                 Table to truncate.
+ * @param offset                New end of the code.
+ */
+static inline void lineTable_truncate(nuc_LineTable* table, int offset) {
+    while (table->count > 0 && table->runs[table->count - 1].offset >= offset) table->count--;
+}
+
+/**
+ * Looks up the line of the code at an offset, by a binary search of the runs. Only used for
+ * reporting (disruptions / disassembly), as passes over a chunk walk its lines with a cursor.
+ * @param table                 Table to search.
+ * @param offset                Offset of the code.
+ */
+static long lineTable_get(const nuc_LineTable* table, int offset) {
+    int low = 0, high = table->count - 1;
+    if (high < 0) return 0;
+
+    // find the last run starting at or before the offset
+    while (low < high) {
+        int mid = low + (high - low + 1) / 2;
+        if (table->runs[mid].offset <= offset) {
+            low = mid;
+        } else {
+            high = mid - 1;
+        }
+    }
+
+    return table->runs[low].line;
+}
+
+/**
+ * Initialises a cursor at the start of a line table.
+ * @param cursor                Cursor to initialise.
+ * @param table                 Table to walk.
+ */
+static inline void lineCursor_init(nuc_LineCursor* cursor, const nuc_LineTable* table) {
+    cursor->table = table;
+    cursor->run = 0;
+}
+
+/**
+ * Retrieves the line of the code at an offset, moving the cursor to its run. Offsets visited in
+ * order only ever step forwards through the runs.
+ * @param cursor                Cursor to move.
+ * @param offset                Offset of the code.
+ */
+static inline long lineCursor_at(nuc_LineCursor* cursor, int offset) {
+    const nuc_LineTable* table = cursor->table;
+    if (table->count == 0) return 0;
+
+    while (cursor->run > 0 && table->runs[cursor->run].offset > offset) cursor->run--;
+    while (cursor->run + 1 < table->count && table->runs[cursor->run + 1].offset <= offset) cursor->run++;
+    return table->runs[cursor->run].line;
+}
+
+#endif
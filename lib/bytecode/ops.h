@@ -38,14 +38,17 @@ typedef enum {
     OP_JUMP,
     OP_JUMP_IF_FALSE,
     OP_JUMP_IF_FALSE_OR_POP,
+    OP_POP_JUMP_IF_FALSE,  // JUMP_IF_FALSE whose condition is popped on both branches
     OP_JUMP_CATCH,
     OP_LOOP,
+    OP_FOR_NUM_PREP,  // skips a numeric 'for' loop if the variable already matches the limit
+    OP_FOR_NUM_LOOP,  // steps a numeric 'for' loop variable, looping whilst it differs from the limit
 
     /** Variable Operations */
     OP_CONSTANT,
-    OP_DEFINE_GLOBAL,
-    OP_GET_GLOBAL,
-    OP_SET_GLOBAL,
+    OP_DEFINE_GLOBAL_SLOT,
+    OP_GET_GLOBAL_SLOT,
+    OP_SET_GLOBAL_SLOT,
     OP_SET_LOCAL,
     OP_GET_LOCAL,
     OP_SET_UPVALUE,
@@ -79,7 +82,16 @@ typedef enum {
 
     /** Library Methods */
     OP_GET_NATIVE,
+    OP_CALL_NATIVE,
+    OP_CALL_NATIVE_NUM,
 
+    /** Fused Operations (superinstructions) */
+    OP_LOCAL_LT_CONST_JUMP,   // GET_LOCAL, CONSTANT, LESS, JUMP_IF_FALSE
+    OP_ADD_LOCALS,            // GET_LOCAL, GET_LOCAL, ADD
+    OP_SUB_LOCAL_CONST,       // GET_LOCAL, CONSTANT, SUB
+    OP_SUB_LOCAL_CONST_CALL,  // GET_LOCAL, CONSTANT, SUB, CALL
+
+    OP_COUNT,  // number of operations (never emitted)
 } OpCode;
 
 #endif
\ No newline at end of file
@@ -0,0 +1,148 @@
+#ifndef NUC_REGISTERS_H
+#define NUC_REGISTERS_H
+
+// C Standard Library
+#include <stdlib.h>
+
+// Nucleus Headers
+#include "../common.h"
+#include "../utils/memory.h"
+#include "lines.h"
+
+/*********************
+ *  EXECUTION TIERS  *
+ *********************/
+
+#define NUC_TIER_STACK 0     // reaction runs the stack bytecode
+#define NUC_TIER_REGISTER 1  // reaction runs the lowered register bytecode
+
+/*************************
+ *  REGISTER OPERATIONS  *
+ *************************/
+
+/**
+ * Nucleus Register Operations. Each instruction is a 32-bit word of [ op | A | B | C ] where A, B and C
+ * name frame slots (registers) directly. Bx denotes B and C combined as a 16-bit operand. Jumps are
+ * followed by a second word holding a signed word offset relative to the end of the instruction.
+ */
+typedef enum {
+    /** Loads */
+    ROP_MOVE,       // R[A] = R[B]
+    ROP_LOADK,      // R[A] = K[Bx]
+    ROP_LOADNULL,   // R[A] = null
+    ROP_LOADTRUE,   // R[A] = true
+    ROP_LOADFALSE,  // R[A] = false
+
+    /** Math Operations */
+    ROP_ADD,       // R[A] = R[B] + R[C]
+    ROP_SUB,       // R[A] = R[B] - R[C]
+    ROP_MUL,       // R[A] = R[B] * R[C]
+    ROP_DIV,       // R[A] = R[B] / R[C]
+    ROP_MOD,       // R[A] = R[B] % R[C]
+    ROP_POW,       // R[A] = R[B] ** R[C]
+    ROP_XOR,       // R[A] = R[B] ^ R[C]
+    ROP_BITW_OR,   // R[A] = R[B] | R[C]
+    ROP_BITW_AND,  // R[A] = R[B] & R[C]
+    ROP_ROL,       // R[A] = R[B] << R[C]
+    ROP_ROR,       // R[A] = R[B] >> R[C]
+    ROP_ADDK,      // R[A] = R[B] + K[C]
+    ROP_SUBK,      // R[A] = R[B] - K[C]
+    ROP_MULK,      // R[A] = R[B] * K[C]
+    ROP_DIVK,      // R[A] = R[B] / K[C]
+    ROP_NEGATE,    // R[A] = -R[B]
+    ROP_BITW_NOT,  // R[A] = ~R[B]
+    ROP_NOT,       // R[A] = !R[B]
+
+    /** Comparisons */
+    ROP_EQUAL,    // R[A] = R[B] = R[C]
+    ROP_LESS,     // R[A] = R[B] < R[C]
+    ROP_GREATER,  // R[A] = R[B] > R[C]
+    ROP_LESSK,    // R[A] = R[B] < K[C]
+
+    /** Control Operations (followed by an offset word) */
+    ROP_JUMP,             // ip += offset
+    ROP_JUMP_IF_FALSE,    // if (!R[A]) ip += offset
+    ROP_LESS_JUMP,        // R[A] = R[B] < R[C]; if (!R[A]) ip += offset
+    ROP_LESSK_JUMP,       // R[A] = R[B] < K[C]; if (!R[A]) ip += offset
+    ROP_FOR_NUM_PREP,     // if (R[A] == R[B]) ip += offset
+    ROP_FOR_NUM_LOOP,     // R[A] += R[C]; if (R[A] != R[B]) ip += offset
+
+    /** Variable Operations */
+    ROP_DEFINE_GLOBAL,  // globals[Bx] = R[A]
+    ROP_GET_GLOBAL,     // R[A] = globals[Bx]
+    ROP_SET_GLOBAL,     // globals[Bx] = R[A]
+    ROP_GET_UPVALUE,    // R[A] = upvalues[Bx]
+    ROP_SET_UPVALUE,    // upvalues[Bx] = R[A]
+    ROP_CLOSE_UPVALUE,  // closes upvalues from R[A] upwards
+    ROP_GET_NATIVE,     // R[A] = natives[Bx]
+
+    /** Reaction Operations */
+    ROP_CALL,             // R[A] = R[A](R[A + 1], ..., R[A + B])
+    ROP_CALL_NATIVE,      // R[A] = natives[C](R[A], ..., R[A + B - 1])
+    ROP_CALL_NATIVE_NUM,  // as ROP_CALL_NATIVE, through the typed entry point when all numeric
+    ROP_CLOSURE,          // R[A] = closure(K[Bx]), followed by a (isLocal << 16 | index) word per upvalue
+    ROP_ARRAY,            // R[A] = [R[A], ..., R[A + Bx - 1]]
+    ROP_RETURN,           // returns R[A]
+} RegOpCode;
+
+/*******************
+ *  WORD ENCODING  *
+ *******************/
+
+#define NUC_REG_ABC(op, a, b, c) ((uint32_t)(op) | ((uint32_t)(a) << 8) | ((uint32_t)(b) << 16) | ((uint32_t)(c) << 24))
+#define NUC_REG_ABX(op, a, bx) ((uint32_t)(op) | ((uint32_t)(a) << 8) | ((uint32_t)(bx) << 16))
+#define NUC_REG_OP(word) ((uint8_t)((word)&0xFF))
+#define NUC_REG_A(word) ((uint8_t)(((word) >> 8) & 0xFF))
+#define NUC_REG_B(word) ((uint8_t)(((word) >> 16) & 0xFF))
+#define NUC_REG_C(word) ((uint8_t)(((word) >> 24) & 0xFF))
+#define NUC_REG_BX(word) ((uint16_t)(((word) >> 16) & 0xFFFF))
+
+/****************************
+ *  REGISTER CHUNK METHODS  *
+ ****************************/
+
+/** Nucleus Register Bytecode Chunks (constants are shared with the stack chunk) */
+typedef struct {
+    int count;            // array based
+    int capacity;         // items
+    uint32_t* code;       // register bytecode words
+    nuc_LineTable lines;  // lines connected to each word
+    int frameSize;        // registers required by a frame
+} nuc_RegChunk;
+
+/**
+ * Initialises a register chunk.
+ * @param chunk                 Chunk to initialise.
+ */
+static inline void regChunk_init(nuc_RegChunk* chunk) {
+    chunk->count = 0;
+    chunk->capacity = 0;
+    chunk->code = NULL;
+    lineTable_init(&chunk->lines);
+    chunk->frameSize = 0;
+}
+
+/**
+ * Frees a register chunk from memory.
+ * @param chunk                 Chunk to free.
+ */
+static inline void regChunk_free(nuc_RegChunk* chunk) {
+    NUC_FREE_ARR(uint32_t, chunk->code, chunk->capacity);
+    lineTable_free(&chunk->lines);
+    regChunk_init(chunk);
+}
+
+/**
+ * Writes a word to a register chunk.
+ * @param chunk                 Chunk to write to.
+ * @param word                  Word to write.
+ * @param line                  Associated line.
+ */
+static inline void regChunk_write(nuc_RegChunk* chunk, uint32_t word, long line) {
+    NUC_GROW_ARR_IF(uint32_t, chunk, code, GROW_FAST);
+    chunk->code[chunk->count] = word;
+    lineTable_add(&chunk->lines, chunk->count, line);
+    chunk->count++;
+}
+
+#endif
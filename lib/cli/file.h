@@ -10,6 +10,7 @@
 #include "../vm/atomizer.h"
 #include "../vm/disruptions/codes.h"
 #include "../vm/disruptions/immediate.h"
+#include "image.h"
 
 /**
  * Reads a file from a given path into memory.
@@ -42,6 +43,29 @@ char* nuc_readFile(const char* path) {
     return buffer;
 }
 
+/**
+ * Compiles and runs the source of a file, through the bytecode image cached beside it. Images are
+ * keyed by the hash of the source, so a stale image is simply recompiled and rewritten.
+ * @param path              Path of the source.
+ * @param source            Source of the file.
+ */
+uint8_t nuc_atomizeCached(const char* path, const char* source) {
+    char* cache = image_path(path);
+    size_t length = strlen(source);
+
+    // load the cached image, or compile and cache the source
+    nuc_ObjReaction* reaction = image_load(cache, source, length);
+    if (reaction != NULL) {
+        lexer_init(source);  // disruptions still quote their lines from the source
+    } else {
+        reaction = nuc_fuse(source);
+        if (reaction != NULL) image_write(cache, reaction, source, length);
+    }
+
+    free(cache);
+    return reaction == NULL ? NUC_EXIT_SYNTAX : nuc_atomizeReaction(reaction);
+}
+
 /**
  * Runs a given file in the atomizer.
  * @param path              Path to run.
@@ -49,7 +73,11 @@ char* nuc_readFile(const char* path) {
 void nuc_runFile(const char* path) {
     char* source = nuc_readFile(path);
     atomizer_init();
+#ifdef NUC_NO_BYTECODE_CACHE
     nuc_atomize(source);
+#else
+    nuc_atomizeCached(path, source);
+#endif
     free(source);  // free the allocated source
 }
 
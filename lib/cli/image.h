@@ -0,0 +1,677 @@
+#ifndef NUC_BYTECODE_IMAGE_H
+#define NUC_BYTECODE_IMAGE_H
+
+// C Standard Library
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef NUC_MMAP_IMAGES  // mapped images
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+// Nucleus Headers
+#include "../compiler/optimiser/lower.h"
+#include "../compiler/optimiser/rewrite.h"
+#include "../utils/hash.h"
+#include "../vm/atomizer.h"
+
+/*******************
+ *  IMAGE DEFINES  *
+ *******************/
+
+#define NUC_IMAGE_MAGIC "NUCB"                 // leading bytes of every image
+#define NUC_IMAGE_VERSION 2                    // bumped whenever the layout changes
+#define NUC_IMAGE_BUILD __DATE__ " " __TIME__  // images are only loaded by the build that wrote them
+#define NUC_IMAGE_ALIGN 8                      // alignment of every image section
+
+// configuration of the build that changes the bytecode it emits / runs
+#ifdef NUC_REGISTER_TIER
+    #define NUC_IMAGE_REGISTER_TIER 1
+#else
+    #define NUC_IMAGE_REGISTER_TIER 0
+#endif
+#ifdef NUC_NO_PEEPHOLE
+    #define NUC_IMAGE_PEEPHOLE 0
+#else
+    #define NUC_IMAGE_PEEPHOLE 1
+#endif
+
+/** Kinds of image constants. */
+typedef enum {
+    IMAGE_VALUE,     // raw (non-object) particle
+    IMAGE_STRING,    // index of an image string
+    IMAGE_REACTION,  // index of an image reaction
+} nuc_ImageKind;
+
+/**
+ * Header of a bytecode image. Every section is addressed by its offset from the start of the image,
+ * so the image can be mapped anywhere. Reactions are stored children first, so constants only ever
+ * refer to reactions before them, and the script is always the final reaction.
+ */
+typedef struct {
+    char magic[4];           // NUC_IMAGE_MAGIC
+    uint32_t version;        // NUC_IMAGE_VERSION
+    uint64_t build;          // fingerprint of the build (opcodes, natives and layouts differ between builds)
+    uint64_t sourceHash;     // hash of the compiled source
+    uint64_t sourceLength;   // length of the compiled source
+    uint64_t size;           // total size of the image
+    uint32_t stringCount;    // strings of the image
+    uint32_t globalCount;    // global slots the code was compiled against
+    uint32_t reactionCount;  // reactions of the image
+    uint32_t padding;
+    uint64_t strings;        // offset of the string records
+    uint64_t globals;        // offset of the global names (string indices by slot)
+    uint64_t reactions;      // offset of the reaction records
+} nuc_ImageHeader;
+
+/** String of an image (NUL terminated characters at an offset). */
+typedef struct {
+    uint64_t offset;
+    uint32_t length;
+    uint32_t padding;
+} nuc_ImageString;
+
+/** Reaction of an image. */
+typedef struct {
+    int32_t arity;           // total arguments expected
+    int32_t defaults;        // arguments defaulted
+    int32_t uvCount;         // upvalue counts
+    int32_t name;            // string index of the name (or -1 for scripts)
+    uint32_t tier;           // execution tier
+    uint32_t count;          // bytes of code
+    uint32_t constantCount;  // constants of the chunk
+    uint32_t cacheCount;     // inline cache sites of the chunk
+    uint32_t lineCount;      // line runs of the chunk
+    uint32_t padding;
+    uint64_t code;           // offset of the code
+    uint64_t lines;          // offset of the line runs
+    uint64_t constants;      // offset of the constant records
+    uint64_t caches;         // offset of the cache site records
+} nuc_ImageReaction;
+
+/** Constant of an image reaction. */
+typedef struct {
+    uint32_t kind;   // nuc_ImageKind
+    uint32_t index;  // string / reaction index
+    uint64_t value;  // raw particle
+} nuc_ImageConstant;
+
+/** Inline cache site of an image reaction. */
+typedef struct {
+    uint8_t op;
+    uint8_t padding;
+    uint16_t name;
+    int32_t line;
+} nuc_ImageCache;
+
+/** Growable byte buffer an image is written to. */
+typedef struct {
+    uint8_t* bytes;
+    int count;
+    int capacity;
+} nuc_ImageBuffer;
+
+/******************
+ *  IMAGE BUFFER  *
+ ******************/
+
+/**
+ * Gets the fingerprint of this build. As the bytecode of an image is trusted, the fingerprint covers
+ * everything the bytecode depends on (and not only when the build was compiled, which is pinned by
+ * reproducible builds).
+ */
+static uint64_t image_build() {
+    const uint64_t config[] = {
+        NUC_IMAGE_VERSION,         // image layout
+        OP_COUNT,                  // operations
+        NUC_NATIVE_REACTIONS_LEN,  // native indices
+        NUC_IMAGE_REGISTER_TIER,   // execution tier
+        NUC_IMAGE_PEEPHOLE,        // peephole pass
+    };
+
+    return hash_wide(NUC_IMAGE_BUILD, sizeof(NUC_IMAGE_BUILD) - 1) ^ hash_wide((const char*)config, sizeof(config));
+}
+
+/**
+ * Reserves zeroed space at the end of an image buffer.
+ * @param buffer                Buffer to reserve in.
+ * @param size                  Bytes to reserve.
+ * @returns                     Offset of the reserved bytes.
+ */
+static int image_reserve(nuc_ImageBuffer* buffer, size_t size) {
+    int offset = buffer->count;
+    if (size == 0) return offset;  // nothing to reserve (and the buffer may not exist yet)
+
+    if (buffer->capacity < buffer->count + (int)size) {
+        int prev = buffer->capacity;
+        while (buffer->capacity < buffer->count + (int)size) buffer->capacity = NUC_CAP_GROW_FAST(buffer->capacity);
+        buffer->bytes = NUC_GROW_ARR(uint8_t, buffer->bytes, prev, buffer->capacity);
+    }
+
+    memset(buffer->bytes + offset, 0, size);
+    buffer->count += (int)size;
+    return offset;
+}
+
+/**
+ * Appends bytes to an image buffer, starting on an aligned offset.
+ * @param buffer                Buffer to append to.
+ * @param data                  Bytes to append (or NULL to leave zeroed).
+ * @param size                  Number of bytes.
+ * @returns                     Offset of the appended bytes.
+ */
+static int image_append(nuc_ImageBuffer* buffer, const void* data, size_t size) {
+    image_reserve(buffer, (NUC_IMAGE_ALIGN - buffer->count % NUC_IMAGE_ALIGN) % NUC_IMAGE_ALIGN);
+    int offset = image_reserve(buffer, size);
+    if (data != NULL && size > 0) memcpy(buffer->bytes + offset, data, size);
+    return offset;
+}
+
+/*******************
+ *  IMAGE WRITING  *
+ *******************/
+
+/** State of an image being written. */
+typedef struct {
+    nuc_ImageBuffer buffer;       // image bytes
+    nuc_Table strings;            // string => string index
+    nuc_ParticleArr stringOrder;  // strings by index
+    nuc_ParticleArr order;        // reactions (children first)
+    bool failed;                  // whether a constant could not be written
+} nuc_ImageWriter;
+
+/**
+ * Retrieves the index of a string in an image, adding the string if it is new.
+ * @param writer                Writer of the image.
+ * @param string                String to index.
+ */
+static uint32_t image_string(nuc_ImageWriter* writer, nuc_ObjString* string) {
+    nuc_Particle index;
+    if (table_get(&writer->strings, string, &index)) return (uint32_t)AS_NUMBER(index);
+
+    table_set(&writer->strings, string, NUC_NUM(writer->stringOrder.count));
+    particleArr_write(&writer->stringOrder, NUC_OBJ(string));
+    return (uint32_t)(writer->stringOrder.count - 1);
+}
+
+/**
+ * Retrieves the index of a (previously ordered) reaction in an image.
+ * @param writer                Writer of the image.
+ * @param reaction              Reaction to find.
+ */
+static uint32_t image_reaction(nuc_ImageWriter* writer, nuc_ObjReaction* reaction) {
+    for (int i = writer->order.count - 1; i >= 0; i--) {
+        if (AS_OBJ(writer->order.values[i]) == (nuc_Obj*)reaction) return (uint32_t)i;
+    }
+    return 0;  // unreachable, as children are always ordered first
+}
+
+/**
+ * Orders a reaction tree children first.
+ * @param writer                Writer of the image.
+ * @param reaction              Root of the tree.
+ */
+static void image_order(nuc_ImageWriter* writer, nuc_ObjReaction* reaction) {
+    nuc_ParticleArr* constants = &reaction->chunk.constants;
+    for (int i = 0; i < constants->count; i++) {
+        if (IS_REACTION(constants->values[i])) image_order(writer, AS_REACTION(constants->values[i]));
+    }
+    particleArr_write(&writer->order, NUC_OBJ(reaction));
+}
+
+/**
+ * Writes the chunk of a reaction to an image.
+ * @param writer                Writer of the image.
+ * @param record                Reaction record to fill (which is NOT within the buffer).
+ * @param reaction              Reaction to write.
+ */
+static void image_writeReaction(nuc_ImageWriter* writer, nuc_ImageReaction* record, nuc_ObjReaction* reaction) {
+    nuc_Chunk* chunk = &reaction->chunk;
+    record->arity = reaction->arity;
+    record->defaults = reaction->defaults;
+    record->uvCount = reaction->uvCount;
+    record->name = reaction->name != NULL ? (int32_t)image_string(writer, reaction->name) : -1;
+    record->tier = reaction->tier;
+    record->count = (uint32_t)chunk->count;
+    record->constantCount = (uint32_t)chunk->constants.count;
+    record->cacheCount = (uint32_t)chunk->caches.count;
+    record->lineCount = (uint32_t)chunk->lines.count;
+
+    // the code and lines are copied as is
+    record->code = image_append(&writer->buffer, chunk->code, chunk->count);
+    record->lines = image_append(&writer->buffer, chunk->lines.runs, sizeof(nuc_LineRun) * chunk->lines.count);
+
+    // constants refer to strings / reactions by index
+    record->constants = image_append(&writer->buffer, NULL, sizeof(nuc_ImageConstant) * chunk->constants.count);
+    for (int i = 0; i < chunk->constants.count; i++) {
+        nuc_Particle value = chunk->constants.values[i];
+        nuc_ImageConstant constant = {IMAGE_VALUE, 0, value};
+        if (IS_STRING(value)) {
+            constant = (nuc_ImageConstant){IMAGE_STRING, image_string(writer, AS_STRING(value)), 0};
+        } else if (IS_REACTION(value)) {
+            constant = (nuc_ImageConstant){IMAGE_REACTION, image_reaction(writer, AS_REACTION(value)), 0};
+        } else if (IS_OBJ(value)) {
+            writer->failed = true;  // no other objects are ever compiled as constants
+        }
+        memcpy(writer->buffer.bytes + record->constants + sizeof(nuc_ImageConstant) * i, &constant, sizeof(constant));
+    }
+
+    // and only the sites of inline caches are kept
+    record->caches = image_append(&writer->buffer, NULL, sizeof(nuc_ImageCache) * chunk->caches.count);
+#ifdef NUC_DEBUG_CACHES
+    for (int i = 0; i < chunk->caches.count; i++) {
+        nuc_InlineCache* cache = &chunk->caches.sites[i];
+        nuc_ImageCache site = {cache->op, 0, cache->name, (int32_t)cache->line};
+        memcpy(writer->buffer.bytes + record->caches + sizeof(nuc_ImageCache) * i, &site, sizeof(site));
+    }
+#endif
+}
+
+/**
+ * Serialises a compiled script into an image buffer.
+ * @param writer                Writer to serialise with.
+ * @param script                Compiled script.
+ * @param source                Source the script was compiled from.
+ * @param length                Length of the source.
+ */
+static void image_serialise(nuc_ImageWriter* writer, nuc_ObjReaction* script, const char* source, size_t length) {
+    nuc_ImageHeader header;
+    memset(&header, 0, sizeof(header));
+    image_append(&writer->buffer, NULL, sizeof(header));
+
+    // the global slots are named first (as the code was compiled against them)
+    int globalCount = atomizer.globalNames.count;
+    uint32_t* globals = NUC_ALLOC(uint32_t, globalCount);
+    for (int i = 0; i < globalCount; i++) globals[i] = image_string(writer, AS_STRING(atomizer.globalNames.values[i]));
+
+    // then every reaction (collecting the strings they refer to)
+    image_order(writer, script);
+    nuc_ImageReaction* records = NUC_ALLOC(nuc_ImageReaction, writer->order.count);
+    for (int i = 0; i < writer->order.count; i++) {
+        image_writeReaction(writer, &records[i], AS_REACTION(writer->order.values[i]));
+    }
+
+    // followed by the strings
+    header.stringCount = (uint32_t)writer->stringOrder.count;
+    header.strings = image_append(&writer->buffer, NULL, sizeof(nuc_ImageString) * header.stringCount);
+    for (uint32_t i = 0; i < header.stringCount; i++) {
+        nuc_ObjString* string = AS_STRING(writer->stringOrder.values[i]);
+        nuc_ImageString record = {image_append(&writer->buffer, string->chars, string->length + 1), (uint32_t)string->length, 0};
+        memcpy(writer->buffer.bytes + header.strings + sizeof(nuc_ImageString) * i, &record, sizeof(record));
+    }
+
+    // and the tables of the globals / reactions
+    header.globalCount = (uint32_t)globalCount;
+    header.globals = image_append(&writer->buffer, globals, sizeof(uint32_t) * globalCount);
+    header.reactionCount = (uint32_t)writer->order.count;
+    header.reactions = image_append(&writer->buffer, records, sizeof(nuc_ImageReaction) * writer->order.count);
+    NUC_FREE_ARR(uint32_t, globals, globalCount);
+    NUC_FREE_ARR(nuc_ImageReaction, records, writer->order.count);
+
+    // finally complete the header
+    memcpy(header.magic, NUC_IMAGE_MAGIC, 4);
+    header.version = NUC_IMAGE_VERSION;
+    header.build = image_build();
+    header.sourceHash = hash_wide(source, length);
+    header.sourceLength = length;
+    header.size = (uint64_t)writer->buffer.count;
+    memcpy(writer->buffer.bytes, &header, sizeof(header));
+}
+
+/**
+ * Writes the image of a compiled script. The image is written beside the destination and then
+ * renamed over it, so a running process that has mapped the previous image is never disturbed.
+ * Images that cannot be written are silently skipped (as they are only ever a cache).
+ * @param path                  Path of the image.
+ * @param script                Compiled script.
+ * @param source                Source the script was compiled from.
+ * @param length                Length of the source.
+ * @returns                     Whether the image was written.
+ */
+static bool image_write(const char* path, nuc_ObjReaction* script, const char* source, size_t length) {
+    nuc_ImageWriter writer;
+    writer.buffer = (nuc_ImageBuffer){NULL, 0, 0};
+    table_init(&writer.strings);
+    particleArr_init(&writer.stringOrder);
+    particleArr_init(&writer.order);
+    writer.failed = false;
+    atomizer_push(NUC_OBJ(script));  // the script is not yet rooted
+    image_serialise(&writer, script, source, length);
+
+    // write to a temporary path first
+    size_t size = strlen(path) + 32;
+    char* temp = NUC_ALLOC(char, size);
+#ifdef NUC_MMAP_IMAGES
+    snprintf(temp, size, "%s.%ld.tmp", path, (long)getpid());
+#else
+    snprintf(temp, size, "%s.tmp", path);
+#endif
+
+    bool written = false;
+    FILE* file = writer.failed ? NULL : fopen(temp, "wb");
+    if (file != NULL) {
+        written = fwrite(writer.buffer.bytes, 1, writer.buffer.count, file) == (size_t)writer.buffer.count;
+        written = (fclose(file) == 0) && written;
+        if (written) {
+#ifndef NUC_MMAP_IMAGES
+            remove(path);  // renaming over an existing file is not portable
+#endif
+            written = rename(temp, path) == 0;
+        }
+        if (!written) remove(temp);
+    }
+
+    // and free the writer
+    NUC_FREE_ARR(char, temp, size);
+    NUC_FREE_ARR(uint8_t, writer.buffer.bytes, writer.buffer.capacity);
+    table_free(&writer.strings);
+    particleArr_free(&writer.stringOrder);
+    particleArr_free(&writer.order);
+    atomizer_pop();
+    return written;
+}
+
+/*******************
+ *  IMAGE LOADING  *
+ *******************/
+
+/** A loaded image (kept for the lifetime of the process, as loaded chunks point into it). */
+typedef struct {
+    uint8_t* bytes;
+    size_t size;
+    bool mapped;
+} nuc_Image;
+
+/**
+ * Checks if a section lies within an image, on an aligned offset.
+ * @param image                 Image to check.
+ * @param offset                Offset of the section.
+ * @param count                 Number of items in the section.
+ * @param size                  Size of each item.
+ */
+static inline bool image_contains(nuc_Image* image, uint64_t offset, uint64_t count, size_t size) {
+    return offset % NUC_IMAGE_ALIGN == 0 && offset <= image->size && count <= (image->size - offset) / size;
+}
+
+/**
+ * Validates an image against the source it claims to be compiled from. Only the structure of the
+ * image is validated, the bytecode itself is trusted (as it was written by this build).
+ * @param image                 Image to validate.
+ * @param source                Source to run.
+ * @param length                Length of the source.
+ */
+static bool image_validate(nuc_Image* image, const char* source, size_t length) {
+    if (image->size < sizeof(nuc_ImageHeader)) return false;
+    nuc_ImageHeader* header = (nuc_ImageHeader*)image->bytes;
+
+    // the image must be for this build / source
+    if (memcmp(header->magic, NUC_IMAGE_MAGIC, 4) != 0 || header->version != NUC_IMAGE_VERSION) return false;
+    if (header->build != image_build()) return false;
+    if (header->size != image->size || header->sourceLength != length) return false;
+    if (header->sourceHash != hash_wide(source, length)) return false;
+
+    // with every section in bounds
+    if (!image_contains(image, header->strings, header->stringCount, sizeof(nuc_ImageString))) return false;
+    if (!image_contains(image, header->globals, header->globalCount, sizeof(uint32_t))) return false;
+    if (!image_contains(image, header->reactions, header->reactionCount, sizeof(nuc_ImageReaction))) return false;
+    if (header->reactionCount == 0 || header->globalCount > UINT16_COUNT) return false;
+
+    nuc_ImageString* strings = (nuc_ImageString*)(image->bytes + header->strings);
+    for (uint32_t i = 0; i < header->stringCount; i++) {
+        if (!image_contains(image, strings[i].offset, (uint64_t)strings[i].length + 1, 1)) return false;
+        if (image->bytes[strings[i].offset + strings[i].length] != '\0') return false;
+    }
+
+    uint32_t* globals = (uint32_t*)(image->bytes + header->globals);
+    for (uint32_t i = 0; i < header->globalCount; i++) {
+        if (globals[i] >= header->stringCount) return false;
+    }
+
+    // and every reaction only referring to what comes before it
+    nuc_ImageReaction* reactions = (nuc_ImageReaction*)(image->bytes + header->reactions);
+    for (uint32_t i = 0; i < header->reactionCount; i++) {
+        nuc_ImageReaction* record = &reactions[i];
+        if (record->name >= (int32_t)header->stringCount || record->count > INT32_MAX || record->lineCount > INT32_MAX) return false;
+        if (!image_contains(image, record->code, record->count, 1)) return false;
+        if (!image_contains(image, record->lines, record->lineCount, sizeof(nuc_LineRun))) return false;
+        if (!image_contains(image, record->constants, record->constantCount, sizeof(nuc_ImageConstant))) return false;
+        if (!image_contains(image, record->caches, record->cacheCount, sizeof(nuc_ImageCache))) return false;
+
+        nuc_ImageConstant* constants = (nuc_ImageConstant*)(image->bytes + record->constants);
+        for (uint32_t j = 0; j < record->constantCount; j++) {
+            if (constants[j].kind == IMAGE_STRING && constants[j].index >= header->stringCount) return false;
+            if (constants[j].kind == IMAGE_REACTION && constants[j].index >= i) return false;
+            if (constants[j].kind > IMAGE_REACTION) return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Relocates the global slots of a chunk, for when the atomizer assigned different slots to the
+ * globals than the compiling atomizer did. Mapped images are private, so this never touches the file.
+ * @param chunk                 Chunk to relocate.
+ * @param slots                 Slot of each compiled slot.
+ */
+static void image_relocate(nuc_Chunk* chunk, int* slots) {
+    for (int offset = 0; offset < chunk->count; offset += chunk_instructionLength(chunk, offset)) {
+        uint8_t inst = chunk->code[offset];
+        if (inst != OP_DEFINE_GLOBAL_SLOT && inst != OP_GET_GLOBAL_SLOT && inst != OP_SET_GLOBAL_SLOT) continue;
+
+        int slot = slots[(uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2]];
+        chunk->code[offset + 1] = (uint8_t)((slot >> 8) & 0xff);
+        chunk->code[offset + 2] = (uint8_t)(slot & 0xff);
+    }
+}
+
+/**
+ * Allocates a reaction of an image before the reactions it contains, as the compiler does (so the
+ * reactions are listed in the same order as a compiled script).
+ * @param image                 Image of the reaction.
+ * @param created               Allocated reactions.
+ * @param index                 Index of the reaction.
+ */
+static void image_allocate(nuc_Image* image, nuc_ObjReaction** created, uint32_t index) {
+    if (created[index] != NULL) return;
+    created[index] = reaction_new();
+
+    nuc_ImageHeader* header = (nuc_ImageHeader*)image->bytes;
+    nuc_ImageReaction* record = (nuc_ImageReaction*)(image->bytes + header->reactions) + index;
+    nuc_ImageConstant* constants = (nuc_ImageConstant*)(image->bytes + record->constants);
+    for (uint32_t i = 0; i < record->constantCount; i++) {
+        if (constants[i].kind == IMAGE_REACTION) image_allocate(image, created, constants[i].index);
+    }
+}
+
+/**
+ * Creates the reactions of a validated image, pointing their code / lines into the image.
+ * @param image                 Image to create from.
+ * @returns                     The script reaction, or NULL if the globals could not be slotted.
+ */
+static nuc_ObjReaction* image_instantiate(nuc_Image* image) {
+    nuc_ImageHeader* header = (nuc_ImageHeader*)image->bytes;
+    nuc_ImageString* records = (nuc_ImageString*)(image->bytes + header->strings);
+    uint32_t* globals = (uint32_t*)(image->bytes + header->globals);
+    nuc_ImageReaction* reactions = (nuc_ImageReaction*)(image->bytes + header->reactions);
+
+    // intern the strings (nothing is collected until the script runs)
+    nuc_ObjString** strings = NUC_ALLOC(nuc_ObjString*, header->stringCount);
+    for (uint32_t i = 0; i < header->stringCount; i++) {
+        strings[i] = objString_copyChars((const char*)image->bytes + records[i].offset, (int)records[i].length);
+    }
+
+    // slot the globals the code was compiled against
+    bool relocate = false;
+    int* slots = NUC_ALLOC(int, header->globalCount);
+    for (uint32_t i = 0; i < header->globalCount; i++) {
+        slots[i] = atomizer_globalSlot(strings[globals[i]]);
+        relocate = relocate || slots[i] != (int)i;
+        if (slots[i] < 0) {  // all the slots are taken
+            NUC_FREE_ARR(nuc_ObjString*, strings, header->stringCount);
+            NUC_FREE_ARR(int, slots, header->globalCount);
+            return NULL;
+        }
+    }
+
+    // allocate the reactions in the order they were compiled
+    nuc_ObjReaction** created = NUC_ALLOC(nuc_ObjReaction*, header->reactionCount);
+    for (uint32_t i = 0; i < header->reactionCount; i++) created[i] = NULL;
+    image_allocate(image, created, header->reactionCount - 1);
+    for (uint32_t i = 0; i < header->reactionCount; i++) image_allocate(image, created, i);
+
+    // and create them
+    for (uint32_t i = 0; i < header->reactionCount; i++) {
+        nuc_ImageReaction* record = &reactions[i];
+        nuc_ObjReaction* reaction = created[i];
+        reaction->arity = record->arity;
+        reaction->defaults = record->defaults;
+        reaction->uvCount = record->uvCount;
+        reaction->name = record->name >= 0 ? strings[record->name] : NULL;
+
+        nuc_Chunk* chunk = &reaction->chunk;
+        chunk->count = (int)record->count;
+        chunk->capacity = (int)record->count;
+        chunk->code = image->bytes + record->code;
+        chunk->lines.count = (int)record->lineCount;
+        chunk->lines.capacity = (int)record->lineCount;
+        chunk->lines.runs = (nuc_LineRun*)(image->bytes + record->lines);
+        chunk->shared = true;
+
+        nuc_ImageConstant* constants = (nuc_ImageConstant*)(image->bytes + record->constants);
+        for (uint32_t j = 0; j < record->constantCount; j++) {
+            switch (constants[j].kind) {
+                case IMAGE_STRING:
+                    particleArr_write(&chunk->constants, NUC_OBJ(strings[constants[j].index]));
+                    break;
+                case IMAGE_REACTION:
+                    particleArr_write(&chunk->constants, NUC_OBJ(created[constants[j].index]));
+                    break;
+                default:
+                    particleArr_write(&chunk->constants, (nuc_Particle)constants[j].value);
+                    break;
+            }
+        }
+
+        nuc_ImageCache* caches = (nuc_ImageCache*)(image->bytes + record->caches);
+        for (uint32_t j = 0; j < record->cacheCount; j++) cacheArr_add(&chunk->caches, caches[j].op, caches[j].name, caches[j].line);
+
+        // and bring the reaction to its execution tier
+        if (relocate) image_relocate(chunk, slots);
+#ifdef NUC_REGISTER_TIER
+        fuser_lowerRegisters(reaction);
+#else
+        if (record->tier == NUC_TIER_REGISTER) fuser_lowerRegisters(reaction);
+#endif
+    }
+
+    nuc_ObjReaction* script = created[header->reactionCount - 1];
+    NUC_FREE_ARR(nuc_ObjString*, strings, header->stringCount);
+    NUC_FREE_ARR(int, slots, header->globalCount);
+    NUC_FREE_ARR(nuc_ObjReaction*, created, header->reactionCount);
+    return script;
+}
+
+/**
+ * Maps (or reads) an image into memory. Images are mapped privately, so relocating the code only
+ * copies the pages it touches.
+ * @param image                 Image to map into.
+ * @param path                  Path of the image.
+ * @returns                     Whether the image could be mapped.
+ */
+static bool image_map(nuc_Image* image, const char* path) {
+#ifdef NUC_MMAP_IMAGES
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(nuc_ImageHeader)) {
+        close(fd);
+        return false;
+    }
+
+    void* bytes = mmap(NULL, (size_t)info.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);  // the mapping outlives the descriptor
+    if (bytes == MAP_FAILED) return false;
+    *image = (nuc_Image){(uint8_t*)bytes, (size_t)info.st_size, true};
+    return true;
+#else
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return false;
+
+    fseek(file, 0L, SEEK_END);
+    long size = ftell(file);
+    rewind(file);
+
+    uint8_t* bytes = size > 0 ? (uint8_t*)malloc((size_t)size) : NULL;
+    bool read = bytes != NULL && fread(bytes, 1, (size_t)size, file) == (size_t)size;
+    fclose(file);
+    if (!read) {
+        free(bytes);
+        return false;
+    }
+
+    *image = (nuc_Image){bytes, (size_t)size, false};
+    return true;
+#endif
+}
+
+/**
+ * Unmaps (or frees) an image from memory.
+ * @param image                 Image to unmap.
+ */
+static void image_unmap(nuc_Image* image) {
+#ifdef NUC_MMAP_IMAGES
+    if (image->mapped) munmap(image->bytes, image->size);
+#else
+    free(image->bytes);
+#endif
+    *image = (nuc_Image){NULL, 0, false};
+}
+
+/**
+ * Loads the compiled script of a source from an image. The image is kept mapped for the rest of
+ * the process, as the loaded chunks point into it.
+ * @param path                  Path of the image.
+ * @param source                Source to run.
+ * @param length                Length of the source.
+ * @returns                     The script reaction, or NULL if there is no valid image for the source.
+ */
+static nuc_ObjReaction* image_load(const char* path, const char* source, size_t length) {
+    nuc_Image image;
+    if (!image_map(&image, path)) return NULL;
+
+    // stale images are ignored (and so are rewritten)
+    nuc_ObjReaction* script = NULL;
+    if (image_validate(&image, source, length)) {
+        gc_finishCollection();  // nothing is rooted until the script is complete
+        size_t nurseryLimit = atomizer.nurseryLimit;
+        atomizer.nurseryLimit = SIZE_MAX;
+        script = image_instantiate(&image);
+        atomizer.nurseryLimit = nurseryLimit;
+    }
+
+    if (script == NULL) image_unmap(&image);
+    return script;
+}
+
+/**
+ * Creates the image path of a source path ("script.nuc" => "script.nucb").
+ * @param path                  Path of the source.
+ * @returns                     Allocated image path.
+ */
+static char* image_path(const char* path) {
+    size_t length = strlen(path);
+    bool nuc = length >= 4 && strcmp(path + length - 4, ".nuc") == 0;
+
+    char* image = (char*)malloc(length + 6);
+    if (image == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Not enough memory available to cache \"%s\".", path);
+    snprintf(image, length + 6, nuc ? "%sb" : "%s.nucb", path);
+    return image;
+}
+
+#endif
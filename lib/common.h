@@ -15,12 +15,39 @@
 #define FRAMES_MAX 1024
 #define STACK_MAX (FRAMES_MAX * UINT8_COUNT)
 
+// dispatch defines (labels-as-values are only available on GCC / Clang, and not in the C++ addon)
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__cplusplus) && !defined(NUC_NO_THREADED_DISPATCH)
+    #define NUC_THREADED_DISPATCH
+#endif
+
+// thread-local storage (for the marking workers of the garbage collector, also built as C++)
+#if defined(__cplusplus)
+    #define NUC_THREAD_LOCAL thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+    #define NUC_THREAD_LOCAL __thread
+#else
+    #define NUC_THREAD_LOCAL _Thread_local
+#endif
+
 // debug defines
 // #define NUC_DEBUG_BYTECODE
 // #define NUC_DEBUG_TRACE
 // #define NUC_DEBUG_STACK_TRACE
 // #define NUC_DEBUG_OP_TRACE
 // #define NUC_DEBUG_GC
+// #define NUC_DEBUG_CACHES  // dumps inline cache hits / misses per site on exit
+
+// compiler defines
+// #define NUC_NO_PEEPHOLE  // skips the peephole pass (to compare against the unoptimised bytecode)
+
+// bytecode cache defines (images are mapped into memory on POSIX systems, otherwise read)
+// #define NUC_NO_BYTECODE_CACHE  // always recompiles scripts (never reading / writing .nucb files)
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(NUC_NO_MMAP)
+    #define NUC_MMAP_IMAGES
+#endif
+
+// execution defines
+// #define NUC_REGISTER_TIER  // lowers every reaction to the register tier (where possible)
 
 // native library definitions
 
@@ -0,0 +1,156 @@
+#ifndef NUC_COMPILER_CODE_H
+#define NUC_COMPILER_CODE_H
+
+// C Standard Library
+#include <stdlib.h>
+#include <string.h>
+
+// Nucleus Headers
+#include "../../bytecode/chunk.h"
+#include "../../utils/memory.h"
+#include "../../vm/disruptions/codes.h"
+#include "../../vm/disruptions/immediate.h"
+#include "../global.h"
+
+/**
+ * Grows a buffer of the code arena to hold at least a given count. Arena buffers are only ever
+ * used by the fuser, so are allocated outside of the garbage collector.
+ * @param type              Type of buffer.
+ * @param buffer            Buffer to grow.
+ * @param capacity          Capacity of the buffer.
+ * @param count             Count required.
+ */
+#define CODE_GROW_BUFFER(type, buffer, capacity, count)                                                 \
+    if ((capacity) < (int)(count)) {                                                                    \
+        while ((capacity) < (int)(count)) (capacity) = NUC_CAP_GROW_FAST(capacity);                     \
+        (buffer) = (type*)realloc((buffer), sizeof(type) * (capacity));                                 \
+        if ((buffer) == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not reallocate space for code."); \
+    }
+
+/************************
+ *  CODE ARENA METHODS  *
+ ************************/
+
+/**
+ * Reserves code space for the chunk being compiled (always the innermost chunk of the arena).
+ * In-progress chunks are repointed if the arena moves.
+ * @param chunk             Chunk being compiled.
+ * @param count             Bytes required by the chunk.
+ */
+static void fuser_reserveCode(nuc_Chunk* chunk, int count) {
+    int start = current->codeStart;
+    uint8_t* prev = codeArena.code;
+    CODE_GROW_BUFFER(uint8_t, codeArena.code, codeArena.capacity, start + count);
+
+    // repoint the in-progress chunks
+    if (codeArena.code != prev) {
+        for (nuc_Fuser* fuser = current; fuser != NULL; fuser = fuser->enclosing) {
+            fuser->reaction->chunk.code = codeArena.code + fuser->codeStart;
+        }
+    }
+
+    chunk->capacity = codeArena.capacity - start;
+}
+
+/**
+ * Claims the top of the code arena for a new fuser, freezing the chunk of the enclosing fuser
+ * until the new fuser completes.
+ * @param fuser             Fuser claiming code space.
+ */
+static void fuser_claimCode(nuc_Fuser* fuser) {
+    nuc_Chunk* chunk = &fuser->reaction->chunk;
+    if (fuser->enclosing != NULL) {
+        nuc_Chunk* enclosing = &fuser->enclosing->reaction->chunk;
+        fuser->codeStart = fuser->enclosing->codeStart + enclosing->count;
+        enclosing->capacity = enclosing->count;
+    } else {
+        fuser->codeStart = 0;
+    }
+
+    chunk->code = codeArena.code + fuser->codeStart;
+    chunk->capacity = codeArena.capacity - fuser->codeStart;
+}
+
+/**
+ * Moves the code of a completed fuser out of the code arena (until the program is complete), and
+ * returns the top of the arena to the enclosing fuser.
+ * @param fuser             Fuser that completed.
+ */
+static void fuser_completeCode(nuc_Fuser* fuser) {
+    nuc_Chunk* chunk = &fuser->reaction->chunk;
+    CODE_GROW_BUFFER(uint8_t, codeArena.program, codeArena.programCapacity, codeArena.programCount + chunk->count);
+    CODE_GROW_BUFFER(nuc_ObjReaction*, codeArena.completed, codeArena.completedCapacity, codeArena.completedCount + 1);
+    if (chunk->count > 0) memcpy(codeArena.program + codeArena.programCount, chunk->code, chunk->count);
+    codeArena.programCount += chunk->count;
+    codeArena.completed[codeArena.completedCount++] = fuser->reaction;
+    chunk->code = NULL;  // until placed in the code segment
+    chunk->capacity = 0;
+
+    // and let the enclosing chunk grow again
+    if (fuser->enclosing != NULL) {
+        nuc_Chunk* enclosing = &fuser->enclosing->reaction->chunk;
+        enclosing->code = codeArena.code + fuser->enclosing->codeStart;
+        enclosing->capacity = codeArena.capacity - fuser->enclosing->codeStart;
+    }
+}
+
+/**************************
+ *  CODE SEGMENT METHODS  *
+ **************************/
+
+/**
+ * Places a completed program into a new code segment. The code of every reaction is laid out
+ * adjacently (in completion order, so nested reactions sit beside their enclosing reaction),
+ * followed by all of their lines.
+ */
+static void fuser_placeProgram() {
+    size_t linesStart = ((size_t)codeArena.programCount + 7) & ~(size_t)7;
+    size_t size = linesStart;
+    for (int i = 0; i < codeArena.completedCount; i++) size += sizeof(nuc_LineRun) * codeArena.completed[i]->chunk.lines.count;
+
+    nuc_CodeSegment* segment = (nuc_CodeSegment*)malloc(sizeof(nuc_CodeSegment) + size);
+    if (segment == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not allocate space for code.");
+    if (codeArena.programCount > 0) memcpy(segment->bytes, codeArena.program, codeArena.programCount);
+    segment->next = codeSegments;
+    codeSegments = segment;
+
+    // and point every chunk into the segment
+    size_t code = 0, lines = linesStart;
+    for (int i = 0; i < codeArena.completedCount; i++) {
+        nuc_Chunk* chunk = &codeArena.completed[i]->chunk;
+        chunk->code = segment->bytes + code;
+        chunk->capacity = chunk->count;
+        code += chunk->count;
+
+        size_t bytes = sizeof(nuc_LineRun) * chunk->lines.count;
+        if (bytes > 0) memcpy(segment->bytes + lines, chunk->lines.runs, bytes);
+        int runs = chunk->lines.count;
+        lineTable_free(&chunk->lines);
+        chunk->lines = (nuc_LineTable){runs, runs, (nuc_LineRun*)(segment->bytes + lines)};
+        chunk->shared = true;
+        lines += bytes;
+    }
+
+    codeArena.programCount = 0;
+    codeArena.completedCount = 0;
+}
+
+/** Frees all the buffers of the code arena (once nothing is being compiled). */
+static void fuser_freeCode() {
+    free(codeArena.code);
+    free(codeArena.scratch);
+    free(codeArena.program);
+    free(codeArena.completed);
+    codeArena = (nuc_CodeArena){NULL, 0, NULL, 0, NULL, 0, 0, NULL, 0, 0};
+}
+
+/** Frees the code segments of every compiled program. */
+static void fuser_freeSegments() {
+    while (codeSegments != NULL) {
+        nuc_CodeSegment* next = codeSegments->next;
+        free(codeSegments);
+        codeSegments = next;
+    }
+}
+
+#endif
@@ -3,6 +3,8 @@
 
 // Nucleus Headers
 #include "../../bytecode/chunk.h"
+#include "../local/table.h"
+#include "code.h"
 
 // FORWARD DECLARATIONS
 static inline void chunk_emitByte(uint8_t byte);
@@ -31,7 +33,7 @@ static void fuser_endScope() {
     while (current->localCount > 0 && current->locals[current->localCount - 1].depth > current->scopeDepth) {
         // close up values if captured or pop if otherwise
         chunk_emitByte(current->locals[current->localCount - 1].isCaptured ? OP_CLOSE_UPVALUE : OP_POP);
-        current->localCount--;
+        fuser_popLocal(current);
     }
 }
 
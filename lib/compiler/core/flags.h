@@ -9,7 +9,9 @@
  *********************/
 
 #define NUC_CFLAGS_NONE (uint32_t)0               // no flags set
-#define NUC_CFLAG_MUTATE_NEXT (uint32_t)(1 << 0)  // denotes the next variable as mutating
+#define NUC_CFLAG_MUTATE_NEXT (uint32_t)(1 << 0)    // denotes the next variable as mutating
+#define NUC_CFLAG_REGISTER_NEXT (uint32_t)(1 << 1)  // denotes the next reaction to run on the register tier
+#define NUC_CFLAG_REGISTER_TIER (uint32_t)(1 << 2)  // denotes the reaction being fused runs on the register tier
 
 /******************
  *  FLAG METHODS  *
@@ -6,14 +6,18 @@
 
 // FORWARD DECLARATIONS
 void gc_markObject(nuc_Obj* object);
+void gc_markMutable(nuc_Obj* object);
 
 /** Marks the compilers roots as safe from garbage collection. */
 void gc_markCompilerRoots() {
     nuc_Fuser* fuser = current;
     while (fuser != NULL) {
-        gc_markObject((nuc_Obj*)fuser->reaction);
+        gc_markMutable((nuc_Obj*)fuser->reaction);  // still gaining constants
         fuser = fuser->enclosing;
     }
+
+    // completed reactions are kept until their code is placed
+    for (int i = 0; i < codeArena.completedCount; i++) gc_markMutable((nuc_Obj*)codeArena.completed[i]);
 }
 
 #endif
\ No newline at end of file
@@ -27,6 +27,22 @@ static uint16_t chunk_makeConstant(nuc_Particle value) {
     return (uint16_t)constant;
 }
 
+/**
+ * Makes a new inline cache for a property / invoke site of the current chunk.
+ * @param op                Operation of the site.
+ * @param name              Name constant of the site.
+ */
+static uint16_t chunk_makeCache(uint8_t op, uint16_t name) {
+    int cache = cacheArr_add(&fuser_currentChunk()->caches, op, name, parser.previous.line);
+    if (cache >= UINT16_MAX) {
+        PARSER_ERROR_AT("Chunk exceeds maximum allowable property sites.");
+        return 0;
+    }
+
+    // return the cache as a short
+    return (uint16_t)cache;
+}
+
 /**
  * Writes a singular byte to the current bytecode chunk.
  * @param byte                      Byte to write.
@@ -84,14 +100,19 @@ static inline void chunk_emitConstant(nuc_Particle value) {
     EMIT_UINT16(constant);
 }
 
+/** Emits a jump address with four bytes saved for later (to fill). */
+static inline int chunk_emitJumpAddr() {
+    EMIT_ADDR(0xFF, 0xFF, 0xFF, 0xFF);
+    return fuser_currentChunk()->count - 4;
+}
+
 /**
  * Emits a jump instruction with two bytes saved for later (to fill)
  * @param inst              Instruction to jump with.
  */
 static inline int chunk_emitJump(uint8_t inst) {
     chunk_emitByte(inst);
-    EMIT_ADDR(0xFF, 0xFF, 0xFF, 0xFF);
-    return fuser_currentChunk()->count - 4;
+    return chunk_emitJumpAddr();
 }
 
 /**
@@ -113,11 +134,10 @@ static void chunk_patchJump(int offset) {
 }
 
 /**
- * Emits the loop operation with a given start of loop.
+ * Emits a backwards jump address to a given start of loop (for the instruction just emitted).
  * @param loopStart             IP for start of loop.
  */
-static void chunk_emitLoop(int loopStart) {
-    EMIT_BYTE(OP_LOOP);  // emit the loop
+static void chunk_emitLoopAddr(int loopStart) {
     int offset = fuser_currentChunk()->count - loopStart + 4;
     if (offset > UINT32_MAX) PARSER_ERROR_AT("Loop body is too large. Exceeds 32-bit range.");
     EMIT_BYTE((offset >> 24) & 0xFF);
@@ -126,6 +146,15 @@ static void chunk_emitLoop(int loopStart) {
     EMIT_BYTE(offset & 0xFF);
 }
 
+/**
+ * Emits the loop operation with a given start of loop.
+ * @param loopStart             IP for start of loop.
+ */
+static inline void chunk_emitLoop(int loopStart) {
+    EMIT_BYTE(OP_LOOP);  // emit the loop
+    chunk_emitLoopAddr(loopStart);
+}
+
 /*******************
  *  HELPER MACROS  *
  *******************/
@@ -135,6 +164,8 @@ static void chunk_emitLoop(int loopStart) {
 #define EMIT_JUMP(inst) chunk_emitJump(inst)
 #define PATCH_JUMP(offset) chunk_patchJump(offset)
 #define EMIT_LOOP(offset) chunk_emitLoop(offset)
+#define EMIT_JUMP_ADDR() chunk_emitJumpAddr()
+#define EMIT_LOOP_ADDR(offset) chunk_emitLoopAddr(offset)
 
 /** Simple macro to help clean up switch case below. */
 #define CASE_EMIT(token, opcode) \
@@ -5,10 +5,16 @@
 #include "core/flags.h"
 #include "global.h"
 #include "lexer/lexer.h"
+#include "optimiser/fusion.h"
+#include "optimiser/lower.h"
 #include "parser/declaration/declaration.h"
 #include "parser/parser.h"
 
-#ifdef NUC_DEBUG_BYTECODE  // debug includes
+#ifndef NUC_NO_PEEPHOLE  // peephole pass (unless compared without it)
+    #include "optimiser/peephole.h"
+#endif
+
+#if defined(NUC_DEBUG_BYTECODE) || defined(NUC_DEBUG_CACHES)  // debug includes
     #include "../bytecode/debug.h"
 #endif
 
@@ -28,35 +34,41 @@ static void fuser_init(nuc_Fuser* fuser, nuc_ReactionType type) {
     fuser->localCount = 0;
     fuser->scopeDepth = 0;
     fuser->immutableCount = 0;
+    fuser_claimScope(fuser);
     NUC_RESET_CFLAGS;
 
-    // and now allocate the new reaction
+    // claim a register tier request from the enclosing compiler
+#ifdef NUC_REGISTER_TIER
+    fuser->flags |= NUC_CFLAG_REGISTER_TIER;
+#endif
+    if (current != NULL && NUC_CHECK_CFLAG(NUC_CFLAG_REGISTER_NEXT)) {
+        NUC_UNSET_CFLAG(NUC_CFLAG_REGISTER_NEXT);
+        fuser->flags |= NUC_CFLAG_REGISTER_TIER;
+    }
+
+    // and now allocate the new reaction (with its code at the top of the code arena)
     fuser->reaction = reaction_new();
+    fuser_claimCode(fuser);
 
     // set the current compiler
     current = fuser;
     if (type != RT_SCRIPT) current->reaction->name = objString_copy(parser.previous.start, parser.previous.length);
 
-    // claim slot 0 for VM use only
-    nuc_Local* local = &current->locals[current->localCount++];
+    // claim slot 0 for VM use only (allowing THIS referencing)
+    nuc_Local* local = fuser_pushLocal(current, syntheticToken(T_THIS, type != RT_REACTION ? "this" : ""));
     local->depth = 0;
-    local->isCaptured = false;
     local->immutable = true;  // want to denote as immutable
-
-    // allow THIS referencing
-    if (type != RT_REACTION) {
-        local->name.start = "this";
-        local->name.length = 4;
-    } else {
-        local->name.start = "";
-        local->name.length = 0;
-    }
 }
 
 /** Coordinates ending the compilation process. */
 static nuc_ObjReaction* fuser_complete() {
     chunk_emitReturn();
     nuc_ObjReaction* reaction = current->reaction;
+    if (!parser.hadError) fuser_fuseChunk(fuser_currentChunk());  // fuse hot instruction sequences
+#ifndef NUC_NO_PEEPHOLE
+    if (!parser.hadError) fuser_peepholeChunk(fuser_currentChunk());  // clean up redundant instructions
+#endif
+    if (!parser.hadError && NUC_CHECK_CFLAG(NUC_CFLAG_REGISTER_TIER)) fuser_lowerRegisters(reaction);
 
 #ifdef NUC_DEBUG_BYTECODE  // display chunk if desired
     if (!parser.hadError) nuc_disassembleChunk(
@@ -64,9 +76,14 @@ static nuc_ObjReaction* fuser_complete() {
         reaction->name != NULL
             ? reaction->name->chars  // using reaction name
             : "<script>");           // or the base script
+    if (!parser.hadError && reaction->tier == NUC_TIER_REGISTER) nuc_disassembleRegisters(
+        &reaction->regs,
+        fuser_currentChunk(),
+        reaction->name != NULL ? reaction->name->chars : "<script>");
 #endif
 
     // and return the compiled reaction
+    fuser_completeCode(current);
     current = current->enclosing;  // decrement the compiler stack
     return reaction;
 }
@@ -92,6 +109,12 @@ nuc_ObjReaction* nuc_fuse(const char* source) {
 
     // return NULL if an error occured
     nuc_ObjReaction* reaction = fuser_complete();  // stop the compilation
+    fuser_releaseScope(&fuser);
+    fuser_freeScopes();
+
+    // place the code of a successful program into its own segment
+    if (!parser.hadError) fuser_placeProgram();
+    fuser_freeCode();
     return parser.hadError ? NULL : reaction;
 }
 
@@ -20,18 +20,73 @@ typedef struct nuc_Fuser {
     nuc_ReactionType type;        // type of compilation
     struct nuc_Fuser* enclosing;  // stack compilers
 
-    // local variable compilation
-    nuc_Local locals[UINT16_COUNT];      // allowing 2 ** 16 locals max
-    size_t localCount;                   // total locals
-    nuc_Upvalue upvalues[UINT16_COUNT];  // available upvalues slots
-    int scopeDepth;                      // current scope depth
-    uint32_t immutables[UINT16_COUNT];   // global immutables list
-    size_t immutableCount;
+    // local variable compilation (tables are claimed from the scope arena)
+    int nesting;             // nesting depth of the fuser (slot within the scope arena)
+    nuc_Local* locals;       // allowing 2 ** 16 locals max
+    size_t localCount;       // total locals
+    int localsCapacity;      // allocated locals
+    int* buckets;            // hashed local names => most recent local (or -1)
+    int bucketsCapacity;     // allocated buckets (always a power of 2)
+    nuc_Upvalue* upvalues;   // available upvalues slots
+    int upvaluesCapacity;    // allocated upvalues
+    int scopeDepth;          // current scope depth
+    uint32_t* immutables;    // global immutables list
+    size_t immutableCount;   // total immutables
+    int immutablesCapacity;  // allocated immutables
+
+    // code compilation
+    int codeStart;  // offset of the chunk code within the code arena
+
+    // expression compilation
+    int operandStart;  // start of the left operand of the infix rule being parsed
 
     // available compiler flags
     uint32_t flags;
 } nuc_Fuser;
 
+/** Scope tables of a fuser, kept in the scope arena whilst no fuser has claimed them. */
+typedef struct {
+    nuc_Local* locals;
+    int localsCapacity;
+    int* buckets;
+    int bucketsCapacity;
+    nuc_Upvalue* upvalues;
+    int upvaluesCapacity;
+    uint32_t* immutables;
+    int immutablesCapacity;
+} nuc_FuserScope;
+
+/** Arena of scope tables (one per fuser nesting depth), reused by every reaction compiled. */
+typedef struct {
+    nuc_FuserScope* scopes;
+    int count;  // claimed scopes
+    int capacity;
+} nuc_FuserArena;
+
+/**
+ * Arena of the code of in-progress chunks. Reactions compile strictly nested, so the innermost
+ * chunk always sits at the top of the arena (and grows in place) whilst its enclosing chunks wait.
+ * Completed code is gathered in completion order, until the program is moved into a code segment.
+ */
+typedef struct {
+    uint8_t* code;                // code of every in-progress chunk (outermost first)
+    int capacity;                 // allocated code
+    uint8_t* scratch;             // rewritten code of the chunk being optimised
+    int scratchCapacity;          // allocated scratch
+    uint8_t* program;             // code of every completed chunk
+    int programCount;             // bytes of completed code
+    int programCapacity;          // allocated completed code
+    nuc_ObjReaction** completed;  // completed reactions (in completion order)
+    int completedCount;           // total completed reactions
+    int completedCapacity;        // allocated completed reactions
+} nuc_CodeArena;
+
+/** Code segment of a compiled program, holding the code (then lines) of all its reactions. */
+typedef struct nuc_CodeSegment {
+    struct nuc_CodeSegment* next;  // previously compiled segment
+    uint8_t bytes[];               // code, then lines
+} nuc_CodeSegment;
+
 /** Model Compilation Structure. */
 typedef struct nuc_ModelFuser {
     struct nuc_ModelFuser* enclosing;
@@ -41,6 +96,15 @@ typedef struct nuc_ModelFuser {
 // global current compiler
 nuc_Fuser* current = NULL;
 
+// global scope table arena
+nuc_FuserArena fuserArena = {NULL, 0, 0};
+
+// global code arena
+nuc_CodeArena codeArena = {NULL, 0, NULL, 0, NULL, 0, 0, NULL, 0, 0};
+
+// code segments of every compiled program (which live as long as their reactions may)
+nuc_CodeSegment* codeSegments = NULL;
+
 // global model compiler
 nuc_ModelFuser* currentModel = NULL;
 
@@ -1,88 +1,108 @@
 #ifndef NUC_KEYWORDS_H
 #define NUC_KEYWORDS_H
 
+// C Standard Library
+#include <string.h>
+
 // Nucleus Headers
 #include "token.h"
 
-// defines for denoting TOTAL items
-#define NUC_TOTAL_KEYWORDS 22
-#define NUC_TOTAL_DIRECTIVES 2
-
-/** Nucleus Keywords */
-const char* __keywords[] = {
-    // control
-    "for",
-    "do",
-    "repif",
-    "if",
-    "else",
-    "return",
-    "try",
-    "catch",
-
-    // constants
-    "false",
-    "true",
-    "null",
-
-    // lib
-    "std",
-    "math",
-
-    // models
-    "new",
-    "this",
-    "super",
-
-    // types
-    "let",
-    "const",
-    "model",
-    "derives",
-    "rn",
-    "reaction",
-};
+/**
+ * Matches a word against a keyword of a switch-trie branch. The length is checked first, so the
+ * words are only compared when they could possibly match.
+ * @param word                  Keyword to match.
+ * @param type                  Token of the keyword.
+ */
+#define KEYWORD(word, type) \
+    if (length == sizeof(word) - 1 && memcmp(start, word, sizeof(word) - 1) == 0) return type
 
-/** Associate Keyword Tokens */
-const TokenType __keywordTokens[] = {
-    T_FOR,
-    T_DO,
-    T_REPEAT_IF,
-    T_IF,
-    T_ELSE,
-    T_RETURN,
-    T_TRY,
-    T_CATCH,
+/*************************
+ *  KEYWORD RECOGNITION  *
+ *************************/
 
-    T_FALSE,
-    T_TRUE,
-    T_NULL,
+/**
+ * Recognises a Nucleus keyword, by a switch-trie on the first character then the length.
+ * @param start                 Start of the identifier.
+ * @param length                Length of the identifier.
+ * @returns                     Keyword token, or T_IDENTIFIER if not a keyword.
+ */
+static TokenType keywords_match(const char* start, int length) {
+    if (length < 2 || length > 8) return T_IDENTIFIER;  // keywords are between "do" and "reaction"
 
-    T_STDLIB,
-    T_MATH,
+    switch (start[0]) {
+        case 'c':
+            KEYWORD("catch", T_CATCH);
+            KEYWORD("const", T_CONST);
+            break;
+        case 'd':
+            KEYWORD("do", T_DO);
+            KEYWORD("derives", T_DERIVES);
+            break;
+        case 'e':
+            KEYWORD("else", T_ELSE);
+            break;
+        case 'f':
+            KEYWORD("for", T_FOR);
+            KEYWORD("false", T_FALSE);
+            break;
+        case 'i':
+            KEYWORD("if", T_IF);
+            break;
+        case 'l':
+            KEYWORD("let", T_LET);
+            break;
+        case 'm':
+            KEYWORD("math", T_MATH);
+            KEYWORD("model", T_MODEL);
+            break;
+        case 'n':
+            KEYWORD("new", T_NEW);
+            KEYWORD("null", T_NULL);
+            break;
+        case 'r':
+            KEYWORD("rn", T_REACTION);
+            KEYWORD("repif", T_REPEAT_IF);
+            KEYWORD("return", T_RETURN);
+            KEYWORD("reaction", T_REACTION);
+            break;
+        case 's':
+            KEYWORD("std", T_STDLIB);
+            KEYWORD("super", T_SUPER);
+            break;
+        case 't':
+            KEYWORD("try", T_TRY);
+            KEYWORD("this", T_THIS);
+            KEYWORD("true", T_TRUE);
+            break;
+    }
 
-    T_NEW,
-    T_THIS,
-    T_SUPER,
+    // otherwise is a generic identifier
+    return T_IDENTIFIER;
+}
 
-    T_LET,
-    T_CONST,
-    T_MODEL,
-    T_DERIVES,
-    T_REACTION,
-    T_REACTION,
-};
+/**
+ * Recognises a Nucleus directive (including the '@'), by a switch on the length.
+ * @param start                 Start of the directive.
+ * @param length                Length of the directive.
+ * @returns                     Directive token, or T_ERROR if not a directive.
+ */
+static TokenType keywords_matchDirective(const char* start, int length) {
+    switch (length) {
+        case 7:
+            KEYWORD("@mutate", T_MUTATE);
+            break;
+        case 9:
+            KEYWORD("@register", T_REGISTER);
+            break;
+        case 10:
+            KEYWORD("@construct", T_IDENTIFIER);
+            break;
+    }
 
-// available directives
-const char* __directives[] = {
-    "@mutate",
-    "@construct",
-};
+    // otherwise is an unknown directive
+    return T_ERROR;
+}
 
-// and their associated tokens
-const TokenType __directiveTokens[] = {
-    T_MUTATE,
-    T_IDENTIFIER,
-};
+#undef KEYWORD
 
-#endif
\ No newline at end of file
+#endif
@@ -258,26 +258,14 @@ static Token lexer_string() {
     return lexer_tokenize(T_LIT_STRING);
 }
 
-/**
- * Checks if a the currently found string matches a given one.
- * @param matcher                   String to match.
- * @param length                    Length of string to match.
- */
-static bool lexer_matchString(const char *matcher, int length) {
-    if (lexer.current - lexer.start != length) return false;
-    return memcmp(lexer.start, matcher, length) == 0;
-}
-
 /** Tokenizes a given directive */
 static Token lexer_directive() {
     lexer_advance();  // eat the @
     while (strings_isAlpha(lexer_peek()) || strings_isDigit(lexer_peek())) lexer_advance();
 
-    // iterate over the directives
-    for (int i = 0; i < NUC_TOTAL_DIRECTIVES; i++) {
-        // and return the appropriate item
-        if (lexer_matchString(__directives[i], strlen(__directives[i]))) return lexer_tokenize(__directiveTokens[i]);
-    }
+    // match the directive
+    TokenType type = keywords_matchDirective(lexer.start, (int)(lexer.current - lexer.start));
+    if (type != T_ERROR) return lexer_tokenize(type);
 
     // otherwise we couldn't match a valid directive
     return lexer_error("Unknown directive declared.");
@@ -303,21 +291,15 @@ static Token lexer_stdlib(const char *message, TokenType type) {
 
 /** Coerces a keyword from the currently parsed identifier. */
 static Token lexer_coerceKeyword() {
-    // iterate over the keywords
-    for (int i = 0; i < NUC_TOTAL_KEYWORDS; i++) {
-        // check for a valid match
-        if (lexer_matchString(__keywords[i], strlen(__keywords[i]))) {
-            if (__keywordTokens[i] == T_STDLIB) {  // return as a native reaction / property
-                return lexer_stdlib("Expected a period after reserved keyword \"std\".", T_STDLIB);
-            } else if (__keywordTokens[i] == T_MATH) {
-                return lexer_stdlib("Expected a period after reserved keyword \"math\".", T_MATH);
-            }
-            return lexer_tokenize(__keywordTokens[i]);
-        }
+    TokenType type = keywords_match(lexer.start, (int)(lexer.current - lexer.start));
+    if (type == T_STDLIB) {  // return as a native reaction / property
+        return lexer_stdlib("Expected a period after reserved keyword \"std\".", T_STDLIB);
+    } else if (type == T_MATH) {
+        return lexer_stdlib("Expected a period after reserved keyword \"math\".", T_MATH);
     }
 
-    // otherwise is a generic token
-    return lexer_tokenize(T_IDENTIFIER);
+    // otherwise a keyword or a generic identifier
+    return lexer_tokenize(type);
 }
 
 /** Tokenizes a given identifier. */
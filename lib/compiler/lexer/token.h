@@ -73,6 +73,7 @@ typedef enum {
 
     // directives
     T_MUTATE,
+    T_REGISTER,
 
     // control tokens
     T_IF,
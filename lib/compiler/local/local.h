@@ -12,6 +12,7 @@
 #include "../parser/declaration/variable.h"
 #include "../parser/expression.h"
 #include "../parser/parser.h"
+#include "table.h"
 #include "type.h"
 
 /****************************
@@ -30,11 +31,8 @@ static void fuser_addLocal(Token name, bool immutable) {
         return;
     }
 
-    // and create a new local with the desired depth and name
-    nuc_Local* local = &current->locals[current->localCount++];
-    local->name = name;
-    local->depth = -1;
-    local->immutable = immutable;
+    // and create a new local with the desired name
+    fuser_pushLocal(current, name)->immutable = immutable;
 }
 
 /**
@@ -60,6 +58,7 @@ static int fuser_addUpvalue(nuc_Fuser* fuser, uint16_t index, bool isLocal, bool
     }
 
     // and add as could not find it
+    FUSER_GROW_TABLE(nuc_Upvalue, fuser, upvalues, uvCount);
     fuser->upvalues[uvCount].isLocal = isLocal;
     fuser->upvalues[uvCount].index = index;
     fuser->upvalues[uvCount].immutable = immutable;
@@ -77,21 +76,31 @@ static bool fuser_areIdentifiersEqual(Token* a, Token* b) {
 }
 
 /**
- * Resolves a local reference by name.
- * @param fuser             Compiler to resolve a local of.
+ * Finds the innermost local with a given name, by walking the hashed bucket chain of the name.
+ * @param fuser             Compiler to find a local of.
  * @param name              Name of local variable.
+ * @returns                 Index of the local, or -1 if not declared.
  */
-static int fuser_resolveLocal(nuc_Fuser* fuser, Token* name) {
-    for (int i = fuser->localCount - 1; i >= 0; i--) {
+static int fuser_findLocal(nuc_Fuser* fuser, Token* name) {
+    uint32_t hash = hash_generic(name->start, name->length);
+    for (int i = fuser->buckets[hash & (fuser->bucketsCapacity - 1)]; i >= 0; i = fuser->locals[i].chain) {
         nuc_Local* local = &fuser->locals[i];
-        if (fuser_areIdentifiersEqual(name, &local->name)) {
-            if (local->depth == -1) PARSER_ERROR_AT("Cannot read local variable in its own initialiser.");
-            return i;
-        }
+        if (local->hash == hash && fuser_areIdentifiersEqual(name, &local->name)) return i;
     }
     return -1;
 }
 
+/**
+ * Resolves a local reference by name.
+ * @param fuser             Compiler to resolve a local of.
+ * @param name              Name of local variable.
+ */
+static int fuser_resolveLocal(nuc_Fuser* fuser, Token* name) {
+    int index = fuser_findLocal(fuser, name);
+    if (index != -1 && fuser->locals[index].depth == -1) PARSER_ERROR_AT("Cannot read local variable in its own initialiser.");
+    return index;
+}
+
 /**
  * Find the origin of an upvalue and check's if it is immutable.
  * @param fuser             Compiler to derive upvalue from.
@@ -0,0 +1,141 @@
+#ifndef NUC_LOCAL_TABLE_H
+#define NUC_LOCAL_TABLE_H
+
+// Nucleus Headers
+#include "../../utils/hash.h"
+#include "../../utils/memory.h"
+#include "../global.h"
+#include "../lexer/token.h"
+#include "type.h"
+
+/**
+ * Grows a scope table of a fuser IFF its new count will exceed its capacity.
+ * @param type              Type of table.
+ * @param fuser             Fuser owning the table.
+ * @param table             Table to grow.
+ * @param count             Current count of the table.
+ */
+#define FUSER_GROW_TABLE(type, fuser, table, count)                                          \
+    if ((fuser)->table##Capacity < (int)(count) + 1) {                                       \
+        int prev = (fuser)->table##Capacity;                                                 \
+        (fuser)->table##Capacity = NUC_CAP_GROW_FAST(prev);                                  \
+        (fuser)->table = NUC_GROW_ARR(type, (fuser)->table, prev, (fuser)->table##Capacity); \
+    }
+
+/*************************
+ *  SCOPE ARENA METHODS  *
+ *************************/
+
+/**
+ * Claims the scope tables of a fuser from the scope arena. Tables are reused between every
+ * fuser at the same nesting depth, so only grow to the largest reaction compiled.
+ * @param fuser             Fuser claiming its tables.
+ */
+static void fuser_claimScope(nuc_Fuser* fuser) {
+    if (fuserArena.capacity < fuserArena.count + 1) {
+        int prev = fuserArena.capacity;
+        fuserArena.capacity = NUC_CAP_GROW_FAST(prev);
+        fuserArena.scopes = NUC_GROW_ARR(nuc_FuserScope, fuserArena.scopes, prev, fuserArena.capacity);
+        for (int i = prev; i < fuserArena.capacity; i++) fuserArena.scopes[i] = (nuc_FuserScope){NULL, 0, NULL, 0, NULL, 0, NULL, 0};
+    }
+
+    // take the tables of the next nesting depth
+    fuser->nesting = fuserArena.count++;
+    nuc_FuserScope* scope = &fuserArena.scopes[fuser->nesting];
+    fuser->locals = scope->locals;
+    fuser->localsCapacity = scope->localsCapacity;
+    fuser->buckets = scope->buckets;
+    fuser->bucketsCapacity = scope->bucketsCapacity;
+    fuser->upvalues = scope->upvalues;
+    fuser->upvaluesCapacity = scope->upvaluesCapacity;
+    fuser->immutables = scope->immutables;
+    fuser->immutablesCapacity = scope->immutablesCapacity;
+
+    // and clear the hashed names of the previous claim
+    for (int i = 0; i < fuser->bucketsCapacity; i++) fuser->buckets[i] = -1;
+}
+
+/**
+ * Returns the (possibly grown) scope tables of a fuser to the scope arena.
+ * @param fuser             Fuser releasing its tables.
+ */
+static void fuser_releaseScope(nuc_Fuser* fuser) {
+    fuserArena.count--;
+    fuserArena.scopes[fuser->nesting] = (nuc_FuserScope){
+        fuser->locals, fuser->localsCapacity,
+        fuser->buckets, fuser->bucketsCapacity,
+        fuser->upvalues, fuser->upvaluesCapacity,
+        fuser->immutables, fuser->immutablesCapacity};
+}
+
+/** Frees all the scope tables of the scope arena (once nothing is being compiled). */
+static void fuser_freeScopes() {
+    for (int i = 0; i < fuserArena.capacity; i++) {
+        nuc_FuserScope* scope = &fuserArena.scopes[i];
+        NUC_FREE_ARR(nuc_Local, scope->locals, scope->localsCapacity);
+        NUC_FREE_ARR(int, scope->buckets, scope->bucketsCapacity);
+        NUC_FREE_ARR(nuc_Upvalue, scope->upvalues, scope->upvaluesCapacity);
+        NUC_FREE_ARR(uint32_t, scope->immutables, scope->immutablesCapacity);
+    }
+
+    NUC_FREE_ARR(nuc_FuserScope, fuserArena.scopes, fuserArena.capacity);
+    fuserArena = (nuc_FuserArena){NULL, 0, 0};
+}
+
+/*************************
+ *  LOCAL TABLE METHODS  *
+ *************************/
+
+/**
+ * Links a local into the hashed local names. Locals are always linked in declaration order, so
+ * each bucket chain runs from the innermost local outwards.
+ * @param fuser             Fuser containing the local.
+ * @param index             Index of the local.
+ */
+static inline void fuser_linkLocal(nuc_Fuser* fuser, int index) {
+    nuc_Local* local = &fuser->locals[index];
+    int* bucket = &fuser->buckets[local->hash & (fuser->bucketsCapacity - 1)];
+    local->chain = *bucket;
+    *bucket = index;
+}
+
+/**
+ * Pushes a new local onto the locals of a fuser (with its name hashed for lookups).
+ * @param fuser             Fuser to push a local to.
+ * @param name              Token name of local.
+ * @returns                 Pushed local.
+ */
+static nuc_Local* fuser_pushLocal(nuc_Fuser* fuser, Token name) {
+    FUSER_GROW_TABLE(nuc_Local, fuser, locals, fuser->localCount);
+
+    // rehash all the locals when the buckets are full
+    if (fuser->bucketsCapacity < (int)fuser->localCount + 1) {
+        int prev = fuser->bucketsCapacity;
+        fuser->bucketsCapacity = NUC_CAP_GROW_FAST(prev);
+        fuser->buckets = NUC_GROW_ARR(int, fuser->buckets, prev, fuser->bucketsCapacity);
+        for (int i = 0; i < fuser->bucketsCapacity; i++) fuser->buckets[i] = -1;
+        for (size_t i = 0; i < fuser->localCount; i++) fuser_linkLocal(fuser, (int)i);
+    }
+
+    // and create the local
+    int index = (int)fuser->localCount++;
+    nuc_Local* local = &fuser->locals[index];
+    local->name = name;
+    local->hash = hash_generic(name.start, name.length);
+    local->depth = -1;
+    local->isCaptured = false;
+    local->immutable = false;
+    fuser_linkLocal(fuser, index);
+    return local;
+}
+
+/**
+ * Pops the most recent local of a fuser (which always heads its bucket chain).
+ * @param fuser             Fuser to pop a local from.
+ */
+static inline void fuser_popLocal(nuc_Fuser* fuser) {
+    nuc_Local* local = &fuser->locals[--fuser->localCount];
+    fuser->buckets[local->hash & (fuser->bucketsCapacity - 1)] = local->chain;
+}
+
+#endif
@@ -15,6 +15,8 @@ typedef struct {
 /** Nucleus Local Variable Structure */
 typedef struct {
     Token name;       // associate token
+    uint32_t hash;    // hash of the name
+    int chain;        // previous local within the same hash bucket (or -1)
     int depth;        // local depth
     bool isCaptured;  // captured within closure
     bool immutable;
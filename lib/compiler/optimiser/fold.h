@@ -0,0 +1,180 @@
+#ifndef NUC_OPTIMISER_FOLD_H
+#define NUC_OPTIMISER_FOLD_H
+
+// C Standard Library
+#include <math.h>
+#include <string.h>
+
+// Nucleus Headers
+#include "../../particle/objects/string.h"
+#include "rewrite.h"
+
+/*********************
+ *  FOLDING HELPERS  *
+ *********************/
+
+/**
+ * Retrieves the value of an operand, if the operand is a single constant.
+ * @param chunk                 Chunk of operand.
+ * @param start                 Start of operand code.
+ * @param end                   End of operand code (exclusive).
+ * @param value                 Pointer to store the constant to.
+ */
+static bool fold_constant(nuc_Chunk* chunk, int start, int end, nuc_Particle* value) {
+    if (end - start != 3 || chunk->code[start] != OP_CONSTANT) return false;
+    *value = chunk->constants.values[(uint16_t)(chunk->code[start + 1] << 8) | chunk->code[start + 2]];
+    return true;
+}
+
+/**
+ * Checks if an operand always results in a numeric (or disrupts). Operands that jump may finish
+ * on any of their branches, so are never known to be numeric.
+ * @param chunk                 Chunk of operand.
+ * @param start                 Start of operand code.
+ * @param end                   End of operand code (exclusive).
+ */
+static bool fold_isNumeric(nuc_Chunk* chunk, int start, int end) {
+    if (start >= end) return false;
+
+    // find the final instruction of the operand
+    int last = start;
+    for (int offset = start; offset < end; offset += chunk_instructionLength(chunk, offset)) {
+        if (chunk_jumpSign(chunk->code[offset]) != 0) return false;
+        last = offset;
+    }
+
+    switch (chunk->code[last]) {
+        case OP_CONSTANT: {
+            nuc_Particle value;
+            return fold_constant(chunk, last, end, &value) && IS_NUMBER(value);
+        }
+
+        // operations that only ever produce numerics (ADD / MUL may produce strings)
+        case OP_SUB:
+        case OP_DIV:
+        case OP_MOD:
+        case OP_POW:
+        case OP_XOR:
+        case OP_BITW_OR:
+        case OP_BITW_AND:
+        case OP_ROL:
+        case OP_ROR:
+        case OP_NEGATE:
+        case OP_BITW_NOT:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * Drops trailing constant instructions from a chunk, along with their constants if nothing else
+ * could refer to them (literal constants are always the newest in the chunk).
+ * @param chunk                 Chunk to truncate.
+ * @param start                 Start of the constant instructions.
+ */
+static void fold_truncate(nuc_Chunk* chunk, int start) {
+    for (int offset = chunk->count - 3; offset >= start; offset -= 3) {
+        uint16_t constant = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+        if (constant == chunk->constants.count - 1) chunk->constants.count--;
+    }
+    chunk->count = start;
+    lineTable_truncate(&chunk->lines, start);
+}
+
+/*********************
+ *  FOLDING METHODS  *
+ *********************/
+
+/** Simple macro to help clean up the folding cases. */
+#define CASE_FOLD(opcode, value)   \
+    case opcode:                   \
+        *result = NUC_NUM(value);  \
+        return true
+
+/**
+ * Folds a binary operation of two constants, mirroring the atomizer. Operations that would disrupt
+ * at runtime (ie: mistyped operands) are left for the atomizer to raise.
+ * @param op                    Operation to fold.
+ * @param a                     Left constant.
+ * @param b                     Right constant.
+ * @param result                Pointer to store the folded value to.
+ * @returns                     Whether the operation could be folded.
+ */
+static bool fold_binary(uint8_t op, nuc_Particle a, nuc_Particle b, nuc_Particle* result) {
+    // string literals are concatenated
+    if (op == OP_ADD && IS_STRING(a) && IS_STRING(b)) {
+        nuc_ObjString* left = AS_STRING(a);
+        nuc_ObjString* right = AS_STRING(b);
+        int length = left->length + right->length;
+        char* chars = NUC_ALLOC(char, length + 1);
+        memcpy(chars, left->chars, left->length);
+        memcpy(chars + left->length, right->chars, right->length);
+        chars[length] = '\0';
+        *result = NUC_OBJ(objString_take(chars, length));
+        return true;
+    }
+
+    // otherwise only numerics can be folded
+    if (!IS_NUMBER(a) || !IS_NUMBER(b)) return false;
+    double x = AS_NUMBER(a), y = AS_NUMBER(b);
+    switch (op) {
+        CASE_FOLD(OP_ADD, x + y);
+        CASE_FOLD(OP_SUB, x - y);
+        CASE_FOLD(OP_MUL, x * y);
+        CASE_FOLD(OP_DIV, x / y);
+        CASE_FOLD(OP_MOD, fmod(x, y));
+        CASE_FOLD(OP_POW, pow(x, y));
+        CASE_FOLD(OP_XOR, (int32_t)x ^ (int32_t)y);
+        CASE_FOLD(OP_BITW_OR, (int32_t)x | (int32_t)y);
+        CASE_FOLD(OP_BITW_AND, (int32_t)x & (int32_t)y);
+        CASE_FOLD(OP_ROL, (int32_t)x << (int32_t)y);
+        CASE_FOLD(OP_ROR, (int32_t)x >> (int32_t)y);
+
+        default:  // comparisons are left as is
+            return false;
+    }
+}
+
+/**
+ * Folds a unary operation of a constant, mirroring the atomizer.
+ * @param op                    Operation to fold.
+ * @param a                     Constant operand.
+ * @param result                Pointer to store the folded value to.
+ * @returns                     Whether the operation could be folded.
+ */
+static bool fold_unary(uint8_t op, nuc_Particle a, nuc_Particle* result) {
+    if (!IS_NUMBER(a)) return false;
+    switch (op) {
+        CASE_FOLD(OP_NEGATE, -AS_NUMBER(a));
+        CASE_FOLD(OP_BITW_NOT, ~(int32_t)AS_NUMBER(a));
+
+        default:
+            return false;
+    }
+}
+
+#undef CASE_FOLD
+
+/**
+ * Checks if a binary operation with a constant right operand leaves a numeric left operand as is.
+ * Adding zero is NOT an identity, as `-0 + 0` is `0`.
+ * @param op                    Operation to check.
+ * @param b                     Right constant.
+ */
+static bool fold_isIdentity(uint8_t op, nuc_Particle b) {
+    if (!IS_NUMBER(b)) return false;
+    switch (op) {
+        case OP_SUB:
+            return AS_NUMBER(b) == 0;
+        case OP_MUL:
+        case OP_DIV:
+        case OP_POW:
+            return AS_NUMBER(b) == 1;
+        default:
+            return false;
+    }
+}
+
+#endif
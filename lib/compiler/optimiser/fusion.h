@@ -0,0 +1,124 @@
+#ifndef NUC_OPTIMISER_FUSION_H
+#define NUC_OPTIMISER_FUSION_H
+
+// Nucleus Headers
+#include "rewrite.h"
+
+/*******************
+ *  FUSION HELPERS  *
+ *******************/
+
+/**
+ * Checks if an instruction sequence starts at a given offset. The sequence is terminated by -1.
+ * @param chunk                 Chunk to check.
+ * @param offset                Offset to check from.
+ * @param ops                   Opcodes to expect (terminated by -1).
+ * @param ends                  Output offsets of the END of each matched instruction.
+ */
+static bool fusion_matches(nuc_Chunk* chunk, int offset, const int* ops, int* ends) {
+    for (int i = 0; ops[i] >= 0; i++) {
+        if (offset >= chunk->count || chunk->code[offset] != ops[i]) return false;
+        offset += chunk_instructionLength(chunk, offset);
+        ends[i] = offset;
+    }
+    return true;
+}
+
+/**
+ * Checks if the constant operand at a given location is a numeric.
+ * @param chunk                 Chunk of constant.
+ * @param operand               Location of constant index.
+ */
+static inline bool fusion_isNumericConstant(nuc_Chunk* chunk, int operand) {
+    uint16_t constant = (uint16_t)(chunk->code[operand] << 8) | chunk->code[operand + 1];
+    return IS_NUMBER(chunk->constants.values[constant]);
+}
+
+/**
+ * Writes the fused instruction header along with the 2-byte operand pairs of the local / constant.
+ * @param rw                    Rewriter to write to.
+ * @param offset                Original offset of the sequence.
+ * @param op                    Fused operation.
+ * @param second                Offset of the second instruction in the sequence.
+ */
+static inline void fusion_writeOperands(nuc_Rewriter* rw, int offset, uint8_t op, int second) {
+    nuc_Chunk* chunk = rw->chunk;
+    long line = rewriter_line(rw, offset);
+    rewriter_mark(rw, offset);
+    rewriter_write(rw, op, line);
+    rewriter_write(rw, chunk->code[offset + 1], line);
+    rewriter_write(rw, chunk->code[offset + 2], line);
+    rewriter_write(rw, chunk->code[second + 1], line);
+    rewriter_write(rw, chunk->code[second + 2], line);
+}
+
+/*****************
+ *  FUSION PASS  *
+ *****************/
+
+// fusable instruction sequences
+static const int __fusion_ltConstJump[] = {OP_GET_LOCAL, OP_CONSTANT, OP_LESS, OP_JUMP_IF_FALSE, -1};
+static const int __fusion_subConstCall[] = {OP_GET_LOCAL, OP_CONSTANT, OP_SUB, OP_CALL, -1};
+static const int __fusion_subConst[] = {OP_GET_LOCAL, OP_CONSTANT, OP_SUB, -1};
+static const int __fusion_addLocals[] = {OP_GET_LOCAL, OP_GET_LOCAL, OP_ADD, -1};
+
+/**
+ * Attempts to fuse a hot instruction sequence into a superinstruction.
+ * @param rw                    Rewriter to write to.
+ * @param offset                Current offset in the original chunk.
+ * @returns                     Offset after the fused sequence, or -1 if nothing was fused.
+ */
+static int fusion_fuse(nuc_Rewriter* rw, int offset) {
+    nuc_Chunk* chunk = rw->chunk;
+    int ends[4];  // end offsets of matched instructions
+
+    // GET_LOCAL, CONSTANT, LESS, JUMP_IF_FALSE => LOCAL_LT_CONST_JUMP
+    if (fusion_matches(chunk, offset, __fusion_ltConstJump, ends) && fusion_isNumericConstant(chunk, ends[0] + 1) && !rewriter_isJumpedInto(rw, offset, ends[3])) {
+        fusion_writeOperands(rw, offset, OP_LOCAL_LT_CONST_JUMP, ends[0]);
+        rewriter_writeTarget(rw, chunk_jumpTarget(chunk, ends[2]), rewriter_line(rw, offset));
+        return ends[3];
+    }
+
+    // GET_LOCAL, CONSTANT, SUB, CALL => SUB_LOCAL_CONST_CALL
+    if (fusion_matches(chunk, offset, __fusion_subConstCall, ends) && fusion_isNumericConstant(chunk, ends[0] + 1) && !rewriter_isJumpedInto(rw, offset, ends[3])) {
+        fusion_writeOperands(rw, offset, OP_SUB_LOCAL_CONST_CALL, ends[0]);
+        rewriter_write(rw, chunk->code[ends[2] + 1], rewriter_line(rw, offset));
+        return ends[3];
+    }
+
+    // GET_LOCAL, CONSTANT, SUB => SUB_LOCAL_CONST
+    if (fusion_matches(chunk, offset, __fusion_subConst, ends) && fusion_isNumericConstant(chunk, ends[0] + 1) && !rewriter_isJumpedInto(rw, offset, ends[2])) {
+        fusion_writeOperands(rw, offset, OP_SUB_LOCAL_CONST, ends[0]);
+        return ends[2];
+    }
+
+    // GET_LOCAL, GET_LOCAL, ADD => ADD_LOCALS
+    if (fusion_matches(chunk, offset, __fusion_addLocals, ends) && !rewriter_isJumpedInto(rw, offset, ends[2])) {
+        fusion_writeOperands(rw, offset, OP_ADD_LOCALS, ends[0]);
+        return ends[2];
+    }
+
+    return -1;  // nothing to fuse
+}
+
+/**
+ * Rewrites hot instruction sequences of a compiled chunk into fused superinstructions. Jumps
+ * and line information are relinked to the compacted layout.
+ * @param chunk                 Chunk to optimise.
+ */
+static void fuser_fuseChunk(nuc_Chunk* chunk) {
+    if (chunk->count == 0) return;
+
+    // rewrite the chunk instruction by instruction
+    nuc_Rewriter rw;
+    rewriter_init(&rw, chunk);
+    for (int offset = 0; offset < chunk->count;) {
+        int next = fusion_fuse(&rw, offset);
+        offset = (next < 0) ? rewriter_copy(&rw, offset) : next;
+    }
+
+    // and complete the rewrite
+    rewriter_complete(&rw);
+}
+
+#endif
@@ -0,0 +1,601 @@
+#ifndef NUC_OPTIMISER_LOWER_H
+#define NUC_OPTIMISER_LOWER_H
+
+// Nucleus Headers
+#include "../../bytecode/registers.h"
+#include "rewrite.h"
+
+/*********************
+ *  LOWERING STATES  *
+ *********************/
+
+/**
+ * Stack bytecode is lowered to register bytecode by tracking the stack depth at every instruction.
+ * Stack slot N of a frame is register N, so locals keep their slot and temporaries land in the
+ * slot they would have been pushed to. Pushes of locals / constants are held as pending operands
+ * and folded straight into the instruction that consumes them.
+ */
+typedef enum {
+    LOWER_REGISTER,  // value lives in a register
+    LOWER_CONSTANT,  // value is a pending constant
+} nuc_LowerKind;
+
+/** Value held by a stack slot during lowering. */
+typedef struct {
+    nuc_LowerKind kind;
+    uint16_t index;  // register / constant index
+} nuc_LowerOperand;
+
+/** Stack bytecode to register bytecode lowering state. */
+typedef struct {
+    nuc_Chunk* chunk;                          // chunk being lowered
+    nuc_RegChunk* regs;                        // register chunk being written
+    nuc_LowerOperand stack[UINT8_COUNT];       // operands held by each stack slot
+    int depth;                                 // current stack depth
+    int* depths;                               // stack depth at original offsets (-1 if unknown)
+    int* words;                                // original offset => register word
+    bool* targets;                             // original offsets that are jumped to
+    int* patches;                              // words holding original jump targets
+    int patchCount;                            // total jumps to patch
+    int retarget;                              // last word whose result register may be retargeted
+    long line;                                 // current line
+    bool failed;                               // denotes the chunk cannot be lowered
+} nuc_Lowerer;
+
+/********************
+ *  EMITTER HELPERS  *
+ ********************/
+
+/**
+ * Writes a register instruction word.
+ * @param lw                    Lowerer to write with.
+ * @param word                  Word to write.
+ */
+static inline int lower_emit(nuc_Lowerer* lw, uint32_t word) {
+    regChunk_write(lw->regs, word, lw->line);
+    lw->retarget = -1;
+    return lw->regs->count - 1;
+}
+
+/**
+ * Writes a jump offset word (holding the original target until relinked).
+ * @param lw                    Lowerer to write with.
+ * @param target                Target offset in the stack chunk.
+ */
+static inline void lower_emitTarget(nuc_Lowerer* lw, int target) {
+    lw->patches[lw->patchCount++] = lower_emit(lw, (uint32_t)target);
+}
+
+/**
+ * Records the depth expected at a forward jump target.
+ * @param lw                    Lowerer to record to.
+ * @param target                Target offset in the stack chunk.
+ * @param depth                 Depth at the target.
+ */
+static inline void lower_recordTarget(nuc_Lowerer* lw, int target, int depth) {
+    if (lw->depths[target] >= 0 && lw->depths[target] != depth) lw->failed = true;
+    lw->depths[target] = depth;
+}
+
+/**
+ * Ensures a stack slot can be used as a register.
+ * @param lw                    Lowerer to check.
+ * @param slot                  Slot to use.
+ */
+static inline void lower_reserve(nuc_Lowerer* lw, int slot) {
+    if (slot >= UINT8_MAX) {
+        lw->failed = true;
+    } else if (slot + 1 > lw->regs->frameSize) {
+        lw->regs->frameSize = slot + 1;
+    }
+}
+
+/**
+ * Materialises a pending operand into the register of its stack slot.
+ * @param lw                    Lowerer to materialise with.
+ * @param slot                  Stack slot to materialise.
+ */
+static void lower_materialise(nuc_Lowerer* lw, int slot) {
+    nuc_LowerOperand operand = lw->stack[slot];
+    if (operand.kind == LOWER_REGISTER && operand.index == slot) return;
+
+    // move the value into the slot
+    lower_emit(lw, operand.kind == LOWER_REGISTER
+                       ? NUC_REG_ABC(ROP_MOVE, slot, operand.index, 0)
+                       : NUC_REG_ABX(ROP_LOADK, slot, operand.index));
+    lw->stack[slot] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+}
+
+/**
+ * Materialises every pending operand (required before jumps / calls).
+ * @param lw                    Lowerer to flush.
+ */
+static inline void lower_flush(nuc_Lowerer* lw) {
+    for (int i = 0; i < lw->depth; i++) lower_materialise(lw, i);
+}
+
+/**
+ * Retrieves the register holding the value of a stack slot.
+ * @param lw                    Lowerer to query.
+ * @param slot                  Stack slot to query.
+ */
+static inline int lower_register(nuc_Lowerer* lw, int slot) {
+    if (lw->stack[slot].kind == LOWER_CONSTANT) lower_materialise(lw, slot);
+    return lw->stack[slot].index;
+}
+
+/**
+ * Pushes a pending operand onto the lowering stack.
+ * @param lw                    Lowerer to push to.
+ * @param kind                  Kind of operand.
+ * @param index                 Register / constant index.
+ */
+static inline void lower_push(nuc_Lowerer* lw, nuc_LowerKind kind, uint16_t index) {
+    lower_reserve(lw, lw->depth);
+    lw->stack[lw->depth++] = (nuc_LowerOperand){kind, index};
+}
+
+/**
+ * Writes an instruction producing a new stack slot value.
+ * @param lw                    Lowerer to write with.
+ * @param op                    Operation.
+ * @param bx                    Bx operand.
+ */
+static inline void lower_pushResult(nuc_Lowerer* lw, RegOpCode op, uint16_t bx) {
+    int slot = lw->depth;
+    lower_reserve(lw, slot);
+    int word = lower_emit(lw, NUC_REG_ABX(op, slot, bx));
+    lw->stack[lw->depth++] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+    lw->retarget = word;
+}
+
+/**
+ * Lowers a unary operation.
+ * @param lw                    Lowerer to write with.
+ * @param op                    Register operation.
+ */
+static inline void lower_unary(nuc_Lowerer* lw, RegOpCode op) {
+    int slot = lw->depth - 1;
+    int word = lower_emit(lw, NUC_REG_ABC(op, slot, lower_register(lw, slot), 0));
+    lw->stack[slot] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+    lw->retarget = word;
+}
+
+/**
+ * Lowers a binary operation.
+ * @param lw                    Lowerer to write with.
+ * @param op                    Register operation.
+ * @param opK                   Register operation with a constant right operand (or `op` if none).
+ */
+static void lower_binary(nuc_Lowerer* lw, RegOpCode op, RegOpCode opK) {
+    int slot = lw->depth - 2;
+    nuc_LowerOperand rhs = lw->stack[slot + 1];
+    int lhs = lower_register(lw, slot);
+
+    // fold small constants straight into the operation
+    int word;
+    if (opK != op && rhs.kind == LOWER_CONSTANT && rhs.index <= UINT8_MAX) {
+        word = lower_emit(lw, NUC_REG_ABC(opK, slot, lhs, rhs.index));
+    } else {
+        word = lower_emit(lw, NUC_REG_ABC(op, slot, lhs, lower_register(lw, slot + 1)));
+    }
+
+    lw->stack[slot] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+    lw->depth--;
+    lw->retarget = word;
+}
+
+/**
+ * Lowers a local assignment, writing the result register directly when possible.
+ * @param lw                    Lowerer to write with.
+ * @param local                 Local slot being set.
+ */
+static void lower_setLocal(nuc_Lowerer* lw, int local) {
+    int top = lw->depth - 1;
+    nuc_LowerOperand value = lw->stack[top];
+    if (value.kind == LOWER_REGISTER && value.index == local) return;  // self-assignment
+
+    // pending reads of the local must observe the OLD value
+    for (int i = 0; i < lw->depth; i++) {
+        if (i != local && i != top && lw->stack[i].kind == LOWER_REGISTER && lw->stack[i].index == local) lower_materialise(lw, i);
+    }
+
+    // write the value to the local
+    if (lw->retarget >= 0 && value.kind == LOWER_REGISTER && value.index == top && NUC_REG_A(lw->regs->code[lw->retarget]) == top) {
+        uint32_t* word = &lw->regs->code[lw->retarget];
+        *word = (*word & ~(uint32_t)0xFF00) | ((uint32_t)local << 8);
+        lw->stack[top].index = (uint16_t)local;
+    } else if (value.kind == LOWER_CONSTANT) {
+        lower_emit(lw, NUC_REG_ABX(ROP_LOADK, local, value.index));
+    } else {
+        lower_emit(lw, NUC_REG_ABC(ROP_MOVE, local, value.index, 0));
+    }
+
+    lw->stack[local] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)local};
+    lw->retarget = -1;
+}
+
+/**
+ * Lowers a call with callee and arguments at the top of the stack.
+ * @param lw                    Lowerer to write with.
+ * @param argCount              Number of arguments.
+ */
+static inline void lower_call(nuc_Lowerer* lw, int argCount) {
+    lower_flush(lw);
+    int slot = lw->depth - 1 - argCount;
+    lower_emit(lw, NUC_REG_ABC(ROP_CALL, slot, argCount, 0));
+    lw->depth = slot + 1;
+}
+
+/**
+ * Lowers a direct native call with its arguments at the top of the stack.
+ * @param lw                    Lowerer to write with.
+ * @param op                    Register call operation.
+ * @param native                Native index.
+ * @param argCount              Number of arguments.
+ */
+static inline void lower_callNative(nuc_Lowerer* lw, RegOpCode op, uint16_t native, int argCount) {
+    if (native > UINT8_MAX) {  // the native index must fit the C operand
+        lw->failed = true;
+        return;
+    }
+
+    lower_flush(lw);
+    int slot = lw->depth - argCount;
+    lower_reserve(lw, slot);
+    lower_emit(lw, NUC_REG_ABC(op, slot, argCount, native));
+    lw->stack[slot] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+    lw->depth = slot + 1;
+}
+
+/*********************
+ *  LOWERING METHODS  *
+ *********************/
+
+/** Reads a short operand from the stack chunk. */
+#define LOWER_SHORT(at) ((uint16_t)(chunk->code[(at)] << 8) | chunk->code[(at) + 1])
+
+/** Simple macro to help clean up the lowering cases. */
+#define CASE_LOWER(opcode, method, ...) \
+    case opcode:                        \
+        method(lw, __VA_ARGS__);        \
+        break
+
+/**
+ * Lowers a single stack instruction.
+ * @param lw                    Lowerer to write with.
+ * @param offset                Offset of the stack instruction.
+ * @returns                     Whether the instruction ends a block (unconditional control flow).
+ */
+static bool lower_instruction(nuc_Lowerer* lw, int offset) {
+    nuc_Chunk* chunk = lw->chunk;
+    uint8_t inst = chunk->code[offset];
+
+    switch (inst) {
+        /** Literals / Variables */
+        case OP_CONSTANT:
+            lower_push(lw, LOWER_CONSTANT, LOWER_SHORT(offset + 1));
+            break;
+        case OP_NULL:
+            lower_pushResult(lw, ROP_LOADNULL, 0);
+            break;
+        case OP_TRUE:
+            lower_pushResult(lw, ROP_LOADTRUE, 0);
+            break;
+        case OP_FALSE:
+            lower_pushResult(lw, ROP_LOADFALSE, 0);
+            break;
+        case OP_GET_LOCAL: {
+            uint16_t local = LOWER_SHORT(offset + 1);
+            if (local >= lw->depth) {  // locals past the stack top are read as null
+                lw->failed = true;
+                break;
+            }
+
+            // copy through pending operands of the local
+            nuc_LowerOperand operand = lw->stack[local];
+            lower_push(lw, operand.kind, operand.index);
+            break;
+        }
+        case OP_SET_LOCAL:
+            lower_setLocal(lw, LOWER_SHORT(offset + 1));
+            break;
+        case OP_POP:
+            lw->depth--;
+            break;
+        case OP_GET_GLOBAL_SLOT:
+            lower_pushResult(lw, ROP_GET_GLOBAL, LOWER_SHORT(offset + 1));
+            break;
+        case OP_SET_GLOBAL_SLOT:
+        case OP_DEFINE_GLOBAL_SLOT: {
+            int reg = lower_register(lw, lw->depth - 1);
+            lower_emit(lw, NUC_REG_ABX(inst == OP_SET_GLOBAL_SLOT ? ROP_SET_GLOBAL : ROP_DEFINE_GLOBAL, reg, LOWER_SHORT(offset + 1)));
+            if (inst == OP_DEFINE_GLOBAL_SLOT) lw->depth--;
+            break;
+        }
+        case OP_GET_UPVALUE:
+            lower_pushResult(lw, ROP_GET_UPVALUE, LOWER_SHORT(offset + 1));
+            break;
+        case OP_SET_UPVALUE: {
+            int reg = lower_register(lw, lw->depth - 1);
+            lower_emit(lw, NUC_REG_ABX(ROP_SET_UPVALUE, reg, LOWER_SHORT(offset + 1)));
+            break;
+        }
+        case OP_CLOSE_UPVALUE:
+            lower_flush(lw);
+            lower_emit(lw, NUC_REG_ABC(ROP_CLOSE_UPVALUE, lw->depth - 1, 0, 0));
+            lw->depth--;
+            break;
+        case OP_GET_NATIVE:
+            lower_pushResult(lw, ROP_GET_NATIVE, LOWER_SHORT(offset + 1));
+            break;
+
+        /** Math / Comparison Operations */
+        CASE_LOWER(OP_ADD, lower_binary, ROP_ADD, ROP_ADDK);
+        CASE_LOWER(OP_SUB, lower_binary, ROP_SUB, ROP_SUBK);
+        CASE_LOWER(OP_MUL, lower_binary, ROP_MUL, ROP_MULK);
+        CASE_LOWER(OP_DIV, lower_binary, ROP_DIV, ROP_DIVK);
+        CASE_LOWER(OP_MOD, lower_binary, ROP_MOD, ROP_MOD);
+        CASE_LOWER(OP_POW, lower_binary, ROP_POW, ROP_POW);
+        CASE_LOWER(OP_XOR, lower_binary, ROP_XOR, ROP_XOR);
+        CASE_LOWER(OP_BITW_OR, lower_binary, ROP_BITW_OR, ROP_BITW_OR);
+        CASE_LOWER(OP_BITW_AND, lower_binary, ROP_BITW_AND, ROP_BITW_AND);
+        CASE_LOWER(OP_ROL, lower_binary, ROP_ROL, ROP_ROL);
+        CASE_LOWER(OP_ROR, lower_binary, ROP_ROR, ROP_ROR);
+        CASE_LOWER(OP_EQUAL, lower_binary, ROP_EQUAL, ROP_EQUAL);
+        CASE_LOWER(OP_LESS, lower_binary, ROP_LESS, ROP_LESSK);
+        CASE_LOWER(OP_GREATER, lower_binary, ROP_GREATER, ROP_GREATER);
+        CASE_LOWER(OP_NEGATE, lower_unary, ROP_NEGATE);
+        CASE_LOWER(OP_BITW_NOT, lower_unary, ROP_BITW_NOT);
+        CASE_LOWER(OP_NOT, lower_unary, ROP_NOT);
+
+        /** Fused Operations (lowered by their constituents) */
+        case OP_ADD_LOCALS:
+        case OP_SUB_LOCAL_CONST:
+        case OP_SUB_LOCAL_CONST_CALL: {
+            uint16_t local = LOWER_SHORT(offset + 1);
+            if (local >= lw->depth) {
+                lw->failed = true;
+                break;
+            }
+            lower_push(lw, lw->stack[local].kind, lw->stack[local].index);
+
+            // the second operand is either a local or a constant
+            if (inst == OP_ADD_LOCALS) {
+                uint16_t other = LOWER_SHORT(offset + 3);
+                if (other >= lw->depth) {
+                    lw->failed = true;
+                    break;
+                }
+                lower_push(lw, lw->stack[other].kind, lw->stack[other].index);
+                lower_binary(lw, ROP_ADD, ROP_ADDK);
+            } else {
+                lower_push(lw, LOWER_CONSTANT, LOWER_SHORT(offset + 3));
+                lower_binary(lw, ROP_SUB, ROP_SUBK);
+            }
+
+            if (inst == OP_SUB_LOCAL_CONST_CALL) lower_call(lw, chunk->code[offset + 5]);
+            break;
+        }
+        case OP_LOCAL_LT_CONST_JUMP: {
+            lower_flush(lw);
+            int slot = lw->depth;
+            uint16_t local = LOWER_SHORT(offset + 1);
+            uint16_t constant = LOWER_SHORT(offset + 3);
+            if (local >= lw->depth) {
+                lw->failed = true;
+                break;
+            }
+
+            // compare against the constant, and jump on false
+            lower_reserve(lw, slot);
+            if (constant <= UINT8_MAX) {
+                lower_emit(lw, NUC_REG_ABC(ROP_LESSK_JUMP, slot, local, constant));
+            } else {
+                lower_emit(lw, NUC_REG_ABX(ROP_LOADK, slot, constant));
+                lower_emit(lw, NUC_REG_ABC(ROP_LESS_JUMP, slot, local, slot));
+            }
+            lower_emitTarget(lw, chunk_jumpTarget(chunk, offset));
+            lw->stack[lw->depth++] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+            lower_recordTarget(lw, chunk_jumpTarget(chunk, offset), lw->depth);
+            break;
+        }
+
+        /** Control Operations */
+        case OP_JUMP_IF_FALSE:
+        case OP_JUMP_IF_FALSE_OR_POP:
+        case OP_POP_JUMP_IF_FALSE: {
+            int count = lw->regs->count;
+            int compare = lw->retarget;
+            int slot = lw->depth - 1;
+            lower_flush(lw);
+
+            // fuse directly with a preceding comparison into the slot
+            uint32_t* word = compare >= 0 && count == lw->regs->count ? &lw->regs->code[compare] : NULL;
+            if (word != NULL && NUC_REG_A(*word) == slot && NUC_REG_OP(*word) == ROP_LESS) {
+                *word = (*word & ~(uint32_t)0xFF) | ROP_LESS_JUMP;
+            } else if (word != NULL && NUC_REG_A(*word) == slot && NUC_REG_OP(*word) == ROP_LESSK) {
+                *word = (*word & ~(uint32_t)0xFF) | ROP_LESSK_JUMP;
+            } else {
+                lower_emit(lw, NUC_REG_ABC(ROP_JUMP_IF_FALSE, slot, 0, 0));
+            }
+
+            lower_emitTarget(lw, chunk_jumpTarget(chunk, offset));
+            if (inst == OP_POP_JUMP_IF_FALSE) lw->depth--;  // the condition is gone on both branches
+            lower_recordTarget(lw, chunk_jumpTarget(chunk, offset), lw->depth);
+            if (inst == OP_JUMP_IF_FALSE_OR_POP) lw->depth--;
+            break;
+        }
+        case OP_JUMP:
+            lower_flush(lw);
+            lower_emit(lw, NUC_REG_ABC(ROP_JUMP, 0, 0, 0));
+            lower_emitTarget(lw, chunk_jumpTarget(chunk, offset));
+            lower_recordTarget(lw, chunk_jumpTarget(chunk, offset), lw->depth);
+            return true;
+        case OP_LOOP: {
+            int target = chunk_jumpTarget(chunk, offset);
+            lower_flush(lw);
+            lower_emit(lw, NUC_REG_ABC(ROP_JUMP, 0, 0, 0));
+            lower_emitTarget(lw, target);
+            if (lw->depths[target] != lw->depth) lw->failed = true;
+            return true;
+        }
+        case OP_FOR_NUM_PREP:
+        case OP_FOR_NUM_LOOP: {
+            int target = chunk_jumpTarget(chunk, offset);
+            uint16_t variable = LOWER_SHORT(offset + 1);
+            uint16_t limit = LOWER_SHORT(offset + 3);
+            uint16_t step = inst == OP_FOR_NUM_LOOP ? LOWER_SHORT(offset + 5) : 0;
+            if (variable >= lw->depth || limit >= lw->depth || step >= lw->depth) {
+                lw->failed = true;
+                break;
+            }
+
+            // the loop locals are read straight from their registers
+            lower_flush(lw);
+            lower_emit(lw, NUC_REG_ABC(inst == OP_FOR_NUM_LOOP ? ROP_FOR_NUM_LOOP : ROP_FOR_NUM_PREP, variable, limit, step));
+            lower_emitTarget(lw, target);
+            if (inst == OP_FOR_NUM_PREP) {
+                lower_recordTarget(lw, target, lw->depth);
+            } else if (lw->depths[target] != lw->depth) {
+                lw->failed = true;
+            }
+            break;
+        }
+        case OP_RETURN:
+            lower_emit(lw, NUC_REG_ABC(ROP_RETURN, lower_register(lw, lw->depth - 1), 0, 0));
+            lw->depth--;
+            return true;
+
+        /** Reaction Operations */
+        case OP_CALL:
+            lower_call(lw, chunk->code[offset + 1]);
+            break;
+        case OP_CALL_NATIVE:
+            lower_callNative(lw, ROP_CALL_NATIVE, LOWER_SHORT(offset + 1), chunk->code[offset + 3]);
+            break;
+        case OP_CALL_NATIVE_NUM:
+            lower_callNative(lw, ROP_CALL_NATIVE_NUM, LOWER_SHORT(offset + 1), chunk->code[offset + 3]);
+            break;
+        case OP_CLOSURE: {
+            lower_flush(lw);
+            uint16_t constant = LOWER_SHORT(offset + 1);
+            int slot = lw->depth;
+            lower_reserve(lw, slot);
+            lower_emit(lw, NUC_REG_ABX(ROP_CLOSURE, slot, constant));
+
+            // and each captured upvalue
+            int uvCount = AS_REACTION(chunk->constants.values[constant])->uvCount;
+            for (int i = 0; i < uvCount; i++) {
+                int at = offset + 3 + i * 3;
+                lower_emit(lw, ((uint32_t)chunk->code[at] << 16) | LOWER_SHORT(at + 1));
+            }
+            lw->stack[lw->depth++] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+            break;
+        }
+        case OP_ARRAY: {
+            lower_flush(lw);
+            uint16_t count = LOWER_SHORT(offset + 1);
+            int slot = lw->depth - count;
+            lower_reserve(lw, slot);
+            lower_emit(lw, NUC_REG_ABX(ROP_ARRAY, slot, count));
+            lw->stack[slot] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)slot};
+            lw->depth = slot + 1;
+            break;
+        }
+
+        // everything else (models, members, catching) remains on the stack tier
+        default:
+            lw->failed = true;
+            break;
+    }
+
+    return false;
+}
+
+#undef LOWER_SHORT
+#undef CASE_LOWER
+
+/**
+ * Lowers the stack bytecode of a reaction into register bytecode. Reactions that cannot be lowered
+ * (ie: using models, members, catches or defaulted arguments) remain on the stack tier.
+ * @param reaction              Reaction to lower.
+ * @returns                     Whether the reaction was lowered.
+ */
+static bool fuser_lowerRegisters(nuc_ObjReaction* reaction) {
+    nuc_Chunk* chunk = &reaction->chunk;
+    if (reaction->defaults > 0 || reaction->arity + 1 >= UINT8_MAX) return false;
+
+    // set up the lowering state
+    nuc_Lowerer lw;
+    lw.chunk = chunk;
+    lw.regs = &reaction->regs;
+    lw.depth = 0;
+    lw.depths = NUC_ALLOC(int, chunk->count + 1);
+    lw.words = NUC_ALLOC(int, chunk->count + 1);
+    lw.targets = NUC_ALLOC(bool, chunk->count + 1);
+    lw.patches = NUC_ALLOC(int, chunk->count + 1);
+    lw.patchCount = 0;
+    lw.retarget = -1;
+    lw.line = 0;
+    lw.failed = false;
+
+    // the callee and arguments are already in place
+    for (int i = 0; i <= chunk->count; i++) {
+        lw.depths[i] = -1;
+        lw.targets[i] = false;
+    }
+    for (int i = 0; i <= reaction->arity; i++) lower_push(&lw, LOWER_REGISTER, (uint16_t)i);
+    for (int offset = 0; offset < chunk->count; offset += chunk_instructionLength(chunk, offset)) {
+        if (chunk_jumpSign(chunk->code[offset]) != 0) lw.targets[chunk_jumpTarget(chunk, offset)] = true;
+    }
+
+    // and lower each instruction
+    bool ended = false;
+    nuc_LineCursor lines;
+    lineCursor_init(&lines, &chunk->lines);
+    for (int offset = 0; offset < chunk->count && !lw.failed; offset += chunk_instructionLength(chunk, offset)) {
+        lw.line = lineCursor_at(&lines, offset);
+        if (lw.targets[offset]) {
+            if (!ended) {  // falling through, so everything must be in its register
+                lower_flush(&lw);
+                if (lw.depths[offset] >= 0 && lw.depths[offset] != lw.depth) lw.failed = true;
+            } else if (lw.depths[offset] >= 0) {
+                lw.depth = lw.depths[offset];
+            }
+
+            // only registers arrive at jump targets
+            for (int i = 0; i < lw.depth; i++) lw.stack[i] = (nuc_LowerOperand){LOWER_REGISTER, (uint16_t)i};
+            lw.retarget = -1;
+        }
+
+        lw.depths[offset] = lw.depth;
+        lw.words[offset] = lw.regs->count;
+        ended = lower_instruction(&lw, offset);
+        if (lw.depth < 0) lw.failed = true;
+    }
+    lw.words[chunk->count] = lw.regs->count;
+
+    // relink the jumps to the register layout
+    for (int i = 0; i < lw.patchCount && !lw.failed; i++) {
+        int at = lw.patches[i];
+        lw.regs->code[at] = (uint32_t)(lw.words[lw.regs->code[at]] - (at + 1));
+    }
+
+    // clean up the lowering state
+    NUC_FREE_ARR(int, lw.depths, chunk->count + 1);
+    NUC_FREE_ARR(int, lw.words, chunk->count + 1);
+    NUC_FREE_ARR(bool, lw.targets, chunk->count + 1);
+    NUC_FREE_ARR(int, lw.patches, chunk->count + 1);
+
+    // and remain on the stack tier if lowering failed
+    if (lw.failed) {
+        regChunk_free(&reaction->regs);
+        return false;
+    }
+
+    reaction->tier = NUC_TIER_REGISTER;
+    return true;
+}
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef NUC_OPTIMISER_PEEPHOLE_H
+#define NUC_OPTIMISER_PEEPHOLE_H
+
+// Nucleus Headers
+#include "rewrite.h"
+
+// maximum jumps followed when threading a jump chain
+#define PEEPHOLE_MAX_THREAD 16
+
+/**********************
+ *  PEEPHOLE HELPERS  *
+ **********************/
+
+/** Pre-scanned control flow of an original chunk. */
+typedef struct {
+    int* refs;    // number of jumps landing on each offset
+    bool* drops;  // condition POPs made redundant by a POP_JUMP_IF_FALSE
+    bool* pops;   // JUMP_IF_FALSEs that pop their condition on both branches
+} nuc_PeepholeFlow;
+
+/**
+ * Checks if an instruction never continues on to the instruction after it.
+ * @param inst                  Instruction to check.
+ */
+static inline bool peephole_isTerminal(uint8_t inst) {
+    return inst == OP_RETURN || inst == OP_JUMP || inst == OP_LOOP;
+}
+
+/**
+ * Checks if an instruction only pushes a value, without any side effects.
+ * @param inst                  Instruction to check.
+ */
+static inline bool peephole_isPurePush(uint8_t inst) {
+    switch (inst) {
+        case OP_CONSTANT:
+        case OP_NULL:
+        case OP_TRUE:
+        case OP_FALSE:
+        case OP_GET_LOCAL:
+        case OP_GET_UPVALUE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/**
+ * Scans the control flow of a chunk. A `JUMP_IF_FALSE` directly followed by a `POP`, that jumps
+ * to a `POP` only reachable by that jump, pops its condition on both branches. These become a
+ * single `POP_JUMP_IF_FALSE` (as emitted by `repif`, `do` and `if` statements).
+ * @param flow                  Flow to initialise.
+ * @param chunk                 Chunk to scan.
+ */
+static void peephole_scan(nuc_PeepholeFlow* flow, nuc_Chunk* chunk) {
+    flow->refs = NUC_ALLOC(int, chunk->count + 1);
+    flow->drops = NUC_ALLOC(bool, chunk->count + 1);
+    flow->pops = NUC_ALLOC(bool, chunk->count + 1);
+    bool* fallsInto = NUC_ALLOC(bool, chunk->count + 1);
+    for (int i = 0; i <= chunk->count; i++) {
+        flow->refs[i] = 0;
+        flow->drops[i] = false;
+        flow->pops[i] = false;
+        fallsInto[i] = false;
+    }
+
+    // count the jumps into each offset, and which offsets are fallen into
+    bool falls = false;
+    for (int offset = 0; offset < chunk->count; offset += chunk_instructionLength(chunk, offset)) {
+        fallsInto[offset] = falls;
+        falls = !peephole_isTerminal(chunk->code[offset]);
+        if (chunk_jumpSign(chunk->code[offset]) != 0) flow->refs[chunk_jumpTarget(chunk, offset)]++;
+    }
+
+    // and find the condition POPs that can be dropped
+    for (int offset = 0; offset < chunk->count; offset += chunk_instructionLength(chunk, offset)) {
+        if (chunk->code[offset] != OP_JUMP_IF_FALSE) continue;
+        int next = offset + chunk_instructionLength(chunk, offset);
+        int target = chunk_jumpTarget(chunk, offset);
+        if (next >= chunk->count || chunk->code[next] != OP_POP || flow->refs[next] > 0) continue;
+        if (target >= chunk->count || chunk->code[target] != OP_POP || flow->refs[target] != 1 || fallsInto[target]) continue;
+        flow->pops[offset] = true;
+        flow->drops[target] = true;
+    }
+
+    NUC_FREE_ARR(bool, fallsInto, chunk->count + 1);
+}
+
+/**
+ * Frees a scanned control flow.
+ * @param flow                  Flow to free.
+ * @param chunk                 Chunk that was scanned.
+ */
+static void peephole_freeFlow(nuc_PeepholeFlow* flow, nuc_Chunk* chunk) {
+    NUC_FREE_ARR(int, flow->refs, chunk->count + 1);
+    NUC_FREE_ARR(bool, flow->drops, chunk->count + 1);
+    NUC_FREE_ARR(bool, flow->pops, chunk->count + 1);
+}
+
+/**
+ * Threads a jump through any unconditional jumps it lands on. Conditional jumps only move forwards,
+ * so their chains are only followed whilst they keep going forwards.
+ * @param chunk                 Chunk containing the jump.
+ * @param offset                Offset of the jump instruction.
+ * @returns                     Final target of the jump.
+ */
+static int peephole_thread(nuc_Chunk* chunk, int offset) {
+    int target = chunk_jumpTarget(chunk, offset);
+    bool forwards = chunk->code[offset] != OP_JUMP && chunk->code[offset] != OP_LOOP;
+
+    // follow the chain (bounded, as empty infinite loops jump to themselves)
+    for (int i = 0; i < PEEPHOLE_MAX_THREAD && target < chunk->count; i++) {
+        uint8_t inst = chunk->code[target];
+        if (inst != OP_JUMP && inst != OP_LOOP) break;
+
+        int next = chunk_jumpTarget(chunk, target);
+        if (forwards && next <= offset) break;
+        target = next;
+    }
+
+    return target;
+}
+
+/**
+ * Writes a (threaded) jump instruction, choosing the direction of unconditional jumps by target.
+ * @param rw                    Rewriter to write to.
+ * @param offset                Original offset of the jump.
+ * @param inst                  Jump instruction to write.
+ * @param target                Target within the original chunk.
+ */
+static void peephole_writeJump(nuc_Rewriter* rw, int offset, uint8_t inst, int target) {
+    nuc_Chunk* chunk = rw->chunk;
+    int length = chunk_instructionLength(chunk, offset);
+    if (inst == OP_JUMP || inst == OP_LOOP) inst = target > offset ? OP_JUMP : OP_LOOP;
+
+    // copy the operands preceding the address
+    long line = rewriter_line(rw, offset);
+    rewriter_mark(rw, offset);
+    rewriter_write(rw, inst, line);
+    for (int i = 1; i < length - 4; i++) rewriter_write(rw, chunk->code[offset + i], line);
+    rewriter_writeTarget(rw, target, line);
+}
+
+/*******************
+ *  PEEPHOLE PASS  *
+ *******************/
+
+/**
+ * Attempts to optimise the instruction at a given offset.
+ * @param rw                    Rewriter to write to.
+ * @param flow                  Scanned control flow of the chunk.
+ * @param offset                Current offset in the original chunk.
+ * @returns                     Offset after the optimised instructions, or -1 to copy as is.
+ */
+static int peephole_optimise(nuc_Rewriter* rw, nuc_PeepholeFlow* flow, int offset) {
+    nuc_Chunk* chunk = rw->chunk;
+    uint8_t inst = chunk->code[offset];
+    int next = offset + chunk_instructionLength(chunk, offset);
+
+    // condition POPs only reached by a POP_JUMP_IF_FALSE are dropped
+    if (flow->drops[offset]) {
+        rewriter_mark(rw, offset);
+        return next;
+    }
+
+    // pushes that are immediately popped are dropped
+    if (peephole_isPurePush(inst) && next < chunk->count && chunk->code[next] == OP_POP && flow->refs[next] == 0) {
+        rewriter_mark(rw, offset);
+        rewriter_mark(rw, next);
+        return next + 1;
+    }
+
+    // JUMP_IF_FALSE, POP => POP_JUMP_IF_FALSE
+    if (flow->pops[offset]) {
+        peephole_writeJump(rw, offset, OP_POP_JUMP_IF_FALSE, peephole_thread(chunk, offset));
+        rewriter_mark(rw, next);
+        return next + 1;
+    }
+
+    // jumps are threaded through jump chains, and dropped if they land on the next instruction
+    switch (inst) {
+        case OP_JUMP: {
+            int target = peephole_thread(chunk, offset);
+            if (target == next) {
+                rewriter_mark(rw, offset);
+                return next;
+            }
+
+            peephole_writeJump(rw, offset, inst, target);
+            return next;
+        }
+
+        case OP_LOOP:
+        case OP_JUMP_IF_FALSE:
+        case OP_JUMP_IF_FALSE_OR_POP:
+        case OP_LOCAL_LT_CONST_JUMP:
+            peephole_writeJump(rw, offset, inst, peephole_thread(chunk, offset));
+            return next;
+
+        default:
+            return -1;
+    }
+}
+
+/**
+ * Runs a peephole pass over a compiled chunk. Pushes that are immediately popped are removed,
+ * jumps are threaded through jump chains, loop conditions are popped by their jump, and code that
+ * can never be reached is dropped. Jumps and line information are relinked to the new layout.
+ * @param chunk                 Chunk to optimise.
+ */
+static void fuser_peepholeChunk(nuc_Chunk* chunk) {
+    if (chunk->count == 0) return;
+
+    // scan the control flow before rewriting
+    nuc_PeepholeFlow flow;
+    peephole_scan(&flow, chunk);
+
+    nuc_Rewriter rw;
+    rewriter_init(&rw, chunk);
+    bool reachable = true;
+    for (int offset = 0; offset < chunk->count;) {
+        if (flow.refs[offset] > 0) reachable = true;  // jump targets are always reachable
+
+        // drop unreachable instructions
+        if (!reachable) {
+            rewriter_mark(&rw, offset);
+            offset += chunk_instructionLength(chunk, offset);
+            continue;
+        }
+
+        // otherwise optimise / copy the instruction
+        reachable = !peephole_isTerminal(chunk->code[offset]);
+        int next = peephole_optimise(&rw, &flow, offset);
+        offset = (next < 0) ? rewriter_copy(&rw, offset) : next;
+    }
+
+    // and complete the rewrite
+    peephole_freeFlow(&flow, chunk);
+    rewriter_complete(&rw);
+}
+
+#endif
@@ -0,0 +1,286 @@
+#ifndef NUC_OPTIMISER_REWRITE_H
+#define NUC_OPTIMISER_REWRITE_H
+
+// C Standard Library
+#include <string.h>
+
+// Nucleus Headers
+#include "../../bytecode/chunk.h"
+#include "../../bytecode/ops.h"
+#include "../../particle/particle.h"
+#include "../../utils/memory.h"
+#include "../core/code.h"
+
+/*************************
+ *  INSTRUCTION HELPERS  *
+ *************************/
+
+/**
+ * Retrieves the total byte length (opcode + operands) of an instruction.
+ * @param chunk                 Chunk containing the instruction.
+ * @param offset                Offset of the instruction.
+ */
+static int chunk_instructionLength(nuc_Chunk* chunk, int offset) {
+    switch (chunk->code[offset]) {
+        case OP_CALL:
+            return 2;
+
+        case OP_CONSTANT:
+        case OP_DEFINE_GLOBAL_SLOT:
+        case OP_GET_GLOBAL_SLOT:
+        case OP_SET_GLOBAL_SLOT:
+        case OP_GET_LOCAL:
+        case OP_SET_LOCAL:
+        case OP_GET_UPVALUE:
+        case OP_SET_UPVALUE:
+        case OP_ARRAY:
+        case OP_MODEL:
+        case OP_METHOD:
+        case OP_FIELD:
+        case OP_GET_SUPER:
+        case OP_GET_NATIVE:
+            return 3;
+
+        case OP_SUPER_INVOKE:
+        case OP_CALL_NATIVE:  // native + arguments
+        case OP_CALL_NATIVE_NUM:
+            return 4;
+
+        case OP_GET_PROPERTY:  // name + inline cache
+        case OP_SET_PROPERTY:
+        case OP_SET_BASE_PROPERTY:
+            return 5;
+
+        case OP_INVOKE:  // name + arguments + inline cache
+            return 6;
+
+        case OP_JUMP:
+        case OP_JUMP_IF_FALSE:
+        case OP_JUMP_IF_FALSE_OR_POP:
+        case OP_POP_JUMP_IF_FALSE:
+        case OP_JUMP_CATCH:
+        case OP_LOOP:
+        case OP_ADD_LOCALS:
+        case OP_SUB_LOCAL_CONST:
+            return 5;
+
+        case OP_SUB_LOCAL_CONST_CALL:
+            return 6;
+
+        case OP_LOCAL_LT_CONST_JUMP:
+        case OP_FOR_NUM_PREP:  // variable + limit + address
+            return 9;
+
+        case OP_FOR_NUM_LOOP:  // variable + limit + step + address
+            return 11;
+
+        case OP_CLOSURE: {  // closures carry 3 bytes per captured upvalue
+            uint16_t constant = (uint16_t)(chunk->code[offset + 1] << 8) | chunk->code[offset + 2];
+            return 3 + 3 * AS_REACTION(chunk->constants.values[constant])->uvCount;
+        }
+
+        default:  // everything else is a simple instruction
+            return 1;
+    }
+}
+
+/**
+ * Retrieves the direction of a jump instruction (1 forwards, -1 backwards), or 0 if the
+ * instruction does not jump. Jumps are always relative to the END of their instruction,
+ * with the 4-byte address stored as the last operand.
+ * @param inst                  Instruction to check.
+ */
+static inline int chunk_jumpSign(uint8_t inst) {
+    switch (inst) {
+        case OP_JUMP:
+        case OP_JUMP_IF_FALSE:
+        case OP_JUMP_IF_FALSE_OR_POP:
+        case OP_POP_JUMP_IF_FALSE:
+        case OP_JUMP_CATCH:
+        case OP_LOCAL_LT_CONST_JUMP:
+        case OP_FOR_NUM_PREP:
+            return 1;
+        case OP_LOOP:
+        case OP_FOR_NUM_LOOP:
+            return -1;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Reads a 4-byte address from a given location.
+ * @param code                  Location of the address.
+ */
+static inline uint32_t chunk_readAddr(uint8_t* code) {
+    return (uint32_t)(code[0] << 24) | (uint32_t)(code[1] << 16) | (uint32_t)(code[2] << 8) | code[3];
+}
+
+/**
+ * Writes a 4-byte address to a given location.
+ * @param code                  Location of the address.
+ * @param addr                  Address to write.
+ */
+static inline void chunk_writeAddr(uint8_t* code, uint32_t addr) {
+    code[0] = (addr >> 24) & 0xFF;
+    code[1] = (addr >> 16) & 0xFF;
+    code[2] = (addr >> 8) & 0xFF;
+    code[3] = addr & 0xFF;
+}
+
+/**
+ * Retrieves the absolute offset a jump instruction targets.
+ * @param chunk                 Chunk containing the jump.
+ * @param offset                Offset of the jump instruction.
+ */
+static inline int chunk_jumpTarget(nuc_Chunk* chunk, int offset) {
+    int end = offset + chunk_instructionLength(chunk, offset);
+    return end + chunk_jumpSign(chunk->code[offset]) * (int)chunk_readAddr(chunk->code + end - 4);
+}
+
+/********************
+ *  CHUNK REWRITER  *
+ ********************/
+
+/**
+ * Rewrites a chunk into a new code buffer, whilst keeping jumps / line information valid. Jumps
+ * written into the rewritten code temporarily hold the ABSOLUTE target in the original chunk, and
+ * are relinked to the new layout once the rewrite is complete.
+ */
+typedef struct {
+    nuc_Chunk* chunk;       // chunk being rewritten
+    int count;              // rewritten bytes
+    int capacity;           // rewritten capacity
+    uint8_t* code;          // rewritten bytecode
+    nuc_LineTable lines;    // rewritten line information
+    nuc_LineCursor cursor;  // position within the original line information
+    int* offsets;           // original offset => rewritten offset
+    bool* targets;          // original offsets that are jumped to
+} nuc_Rewriter;
+
+/**
+ * Initialises a rewriter for a given chunk.
+ * @param rw                    Rewriter to initialise.
+ * @param chunk                 Chunk to rewrite.
+ */
+static void rewriter_init(nuc_Rewriter* rw, nuc_Chunk* chunk) {
+    rw->chunk = chunk;
+    rw->count = 0;
+    rw->capacity = codeArena.scratchCapacity;
+    rw->code = codeArena.scratch;
+    lineTable_init(&rw->lines);
+    lineCursor_init(&rw->cursor, &chunk->lines);
+    rw->offsets = NUC_ALLOC(int, chunk->count + 1);
+    rw->targets = NUC_ALLOC(bool, chunk->count + 1);
+
+    // mark all the locations jumped to
+    for (int i = 0; i <= chunk->count; i++) rw->targets[i] = false;
+    for (int offset = 0; offset < chunk->count; offset += chunk_instructionLength(chunk, offset)) {
+        if (chunk_jumpSign(chunk->code[offset]) != 0) rw->targets[chunk_jumpTarget(chunk, offset)] = true;
+    }
+}
+
+/**
+ * Checks if any jump lands INSIDE a range of the original chunk (excluding the start).
+ * @param rw                    Rewriter to check.
+ * @param start                 Start of range.
+ * @param end                   End of range (exclusive).
+ */
+static inline bool rewriter_isJumpedInto(nuc_Rewriter* rw, int start, int end) {
+    for (int i = start + 1; i < end; i++)
+        if (rw->targets[i]) return true;
+    return false;
+}
+
+/**
+ * Writes a byte to the rewritten chunk.
+ * @param rw                    Rewriter to write to.
+ * @param byte                  Byte to write.
+ * @param line                  Associated line.
+ */
+static inline void rewriter_write(nuc_Rewriter* rw, uint8_t byte, long line) {
+    CODE_GROW_BUFFER(uint8_t, rw->code, rw->capacity, rw->count + 1);
+    rw->code[rw->count] = byte;
+    lineTable_add(&rw->lines, rw->count, line);
+    rw->count++;
+}
+
+/**
+ * Retrieves the line of an original instruction (which are visited in order).
+ * @param rw                    Rewriter of the chunk.
+ * @param offset                Original instruction offset.
+ */
+static inline long rewriter_line(nuc_Rewriter* rw, int offset) { return lineCursor_at(&rw->cursor, offset); }
+
+/**
+ * Writes a 4-byte ABSOLUTE jump target (relinked in `rewriter_complete`).
+ * @param rw                    Rewriter to write to.
+ * @param target                Target offset within the original chunk.
+ * @param line                  Associated line.
+ */
+static inline void rewriter_writeTarget(nuc_Rewriter* rw, int target, long line) {
+    for (int i = 0; i < 4; i++) rewriter_write(rw, 0xFF, line);
+    chunk_writeAddr(rw->code + rw->count - 4, (uint32_t)target);
+}
+
+/**
+ * Denotes the start of a rewritten instruction that replaces an original instruction.
+ * @param rw                    Rewriter to mark.
+ * @param offset                Original instruction offset.
+ */
+static inline void rewriter_mark(nuc_Rewriter* rw, int offset) { rw->offsets[offset] = rw->count; }
+
+/**
+ * Copies an original instruction into the rewritten chunk as is.
+ * @param rw                    Rewriter to copy to.
+ * @param offset                Offset of original instruction.
+ * @returns                     Offset of the next original instruction.
+ */
+static int rewriter_copy(nuc_Rewriter* rw, int offset) {
+    nuc_Chunk* chunk = rw->chunk;
+    int length = chunk_instructionLength(chunk, offset);
+    bool jumps = chunk_jumpSign(chunk->code[offset]) != 0;
+
+    // copy the instruction bytes (excluding jump addresses)
+    long line = rewriter_line(rw, offset);
+    rewriter_mark(rw, offset);
+    for (int i = 0; i < length - (jumps ? 4 : 0); i++) rewriter_write(rw, chunk->code[offset + i], line);
+    if (jumps) rewriter_writeTarget(rw, chunk_jumpTarget(chunk, offset), line);
+    return offset + length;
+}
+
+/**
+ * Completes rewriting a chunk by relinking all jumps and swapping the code buffers.
+ * @param rw                    Rewriter to complete.
+ */
+static void rewriter_complete(nuc_Rewriter* rw) {
+    nuc_Chunk* chunk = rw->chunk;
+    rw->offsets[chunk->count] = rw->count;  // map the chunk end as well
+
+    // copy the rewritten code back in (returning the scratch buffer to the code arena)
+    NUC_FREE_ARR(bool, rw->targets, chunk->count + 1);
+    int originalCount = chunk->count;
+    if (chunk->capacity < rw->count) fuser_reserveCode(chunk, rw->count);
+    memcpy(chunk->code, rw->code, rw->count);
+    codeArena.scratch = rw->code;
+    codeArena.scratchCapacity = rw->capacity;
+    lineTable_free(&chunk->lines);
+    chunk->lines = rw->lines;
+    chunk->count = rw->count;
+
+    // and relink the absolute targets to relative jumps
+    for (int offset = 0; offset < chunk->count;) {
+        int length = chunk_instructionLength(chunk, offset);
+        int sign = chunk_jumpSign(chunk->code[offset]);
+        if (sign != 0) {
+            uint8_t* addr = chunk->code + offset + length - 4;
+            int target = rw->offsets[chunk_readAddr(addr)];
+            chunk_writeAddr(addr, (uint32_t)(sign * (target - (offset + length))));
+        }
+        offset += length;
+    }
+
+    NUC_FREE_ARR(int, rw->offsets, originalCount + 1);
+}
+
+#endif
@@ -20,7 +20,7 @@ static void nuc_declaration() {
         fuser_modelDeclaration();
     } else if (MATCH(T_REACTION)) {
         fuser_reactionDeclaration();
-    } else if (MATCH(T_MUTATE)) {
+    } else if (MATCH(T_MUTATE) || MATCH(T_REGISTER)) {
         fuser_directiveDeclaration(&parser.previous);
     } else {
         nuc_statement();
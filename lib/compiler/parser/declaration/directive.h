@@ -18,6 +18,12 @@ static void fuser_directiveDeclaration(Token* directive) {
             nuc_declaration();  // expect FIRST const to be set to be ignored
             break;
 
+        case T_REGISTER:
+            NUC_SET_CFLAG(NUC_CFLAG_REGISTER_NEXT);
+            nuc_declaration();                        // the next reaction claims the flag
+            NUC_UNSET_CFLAG(NUC_CFLAG_REGISTER_NEXT);  // and ignore it otherwise
+            break;
+
         // ignore invalid items
         default:
             return;
@@ -12,6 +12,7 @@
 
 // FORWARD DECLARATION
 static uint16_t fuser_identifierConstant(Token* name);
+static uint16_t fuser_globalSlot(Token* name);
 static void fuser_declareVariable(bool immutable);
 static void fuser_defineVariable(uint16_t global);
 static void fuser_namedVariable(Token name, bool canAssign, bool ignoreExpression);
@@ -61,7 +62,7 @@ static void fuser_modelDeclaration() {
     // now want to emit the model bytes
     EMIT_BYTE(OP_MODEL);
     EMIT_UINT16(nameConstant);
-    fuser_defineVariable(nameConstant);  // and wan to name to be immutable
+    fuser_defineVariable(current->scopeDepth > 0 ? 0 : fuser_globalSlot(&modelName));  // and wan to name to be immutable
 
     // and set as a new model fuser
     nuc_ModelFuser modelFuser;
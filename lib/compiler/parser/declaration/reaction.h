@@ -76,6 +76,7 @@ static void nuc_reaction(nuc_ReactionType type) {
         EMIT_BYTE(fuser.upvalues[i].isLocal ? 1 : 0);
         EMIT_UINT16(fuser.upvalues[i].index);
     }
+    fuser_releaseScope(&fuser);
 }
 
 /** Compiles a Reaction Declaration. */
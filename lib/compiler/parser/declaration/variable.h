@@ -3,6 +3,7 @@
 
 // Nucleus Includes
 #include "../../../particle/particle.h"
+#include "../../../vm/core/globals.h"
 #include "../../emit.h"
 #include "../../local/local.h"
 #include "../expression.h"
@@ -24,6 +25,20 @@ static uint16_t fuser_identifierConstant(Token* name) {
     return chunk_makeConstant(NUC_OBJ(objString_copy(name->start, name->length)));
 }
 
+/**
+ * Resolves the global slot of an identifier. Slots are handed out by the atomizer the first time a
+ * name is defined or referenced, so every chunk agrees on where a global lives.
+ * @param name              Token holding identifier name.
+ */
+static uint16_t fuser_globalSlot(Token* name) {
+    int slot = atomizer_globalSlot(objString_copy(name->start, name->length));
+    if (slot == -1) {
+        PARSER_ERROR_AT("Too many global variables in one program.");
+        return 0;
+    }
+    return (uint16_t)slot;
+}
+
 /** 
  * Declares a local variable to the current compiler. 
  * @param immutable                         Denotes an immutable variable.
@@ -34,15 +49,12 @@ static void fuser_declareVariable(bool immutable) {
     // retrieve the locals name
     Token* name = &parser.previous;
 
-    // check if the local has already been declared, but only within THIS scope
-    for (int i = current->localCount - 1; i >= 0; i--) {  // iterate backwards, as hit rate will occur with CURRENT scopes
-        nuc_Local* local = &current->locals[i];
-
-        // if we finish reading the current scope, then break out of the loop
-        if (local->depth != -1 && local->depth < current->scopeDepth) break;
-
-        // check there is no overlap for a variable
-        if (fuser_areIdentifiersEqual(name, &local->name)) {
+    // check if the local has already been declared, but only within THIS scope (the innermost
+    // local of the same name is the only one that could be)
+    int index = fuser_findLocal(current, name);
+    if (index != -1) {
+        nuc_Local* local = &current->locals[index];
+        if (local->depth == -1 || local->depth >= current->scopeDepth) {
             PARSER_ERROR_AT("A variable already exists with this name in this scope.");
         }
     }
@@ -53,7 +65,7 @@ static void fuser_declareVariable(bool immutable) {
 
 /**
  * Emits a global reference to define.
- * @param global            Global reference value.
+ * @param global            Global slot.
  */
 static void fuser_defineVariable(uint16_t global) {
     if (current->scopeDepth > 0) {
@@ -61,7 +73,7 @@ static void fuser_defineVariable(uint16_t global) {
         return;
     }
 
-    EMIT_BYTE(OP_DEFINE_GLOBAL);
+    EMIT_BYTE(OP_DEFINE_GLOBAL_SLOT);
     EMIT_UINT16(global);
 }
 
@@ -71,6 +83,7 @@ static void fuser_defineVariable(uint16_t global) {
  * @param ghash                             Global hash reference.
  */
 static inline void fuser_addGlobalImmutable(uint32_t ghash) {
+    FUSER_GROW_TABLE(uint32_t, current, immutables, current->immutableCount);
     current->immutables[current->immutableCount++] = ghash;
 }
 
@@ -100,7 +113,7 @@ static uint16_t fuser_parseVariable(const char* message, bool immutable) {
     if (current->scopeDepth > 0) return 0;
 
     // save if the global is immutable or not to the global scope
-    uint16_t global = fuser_identifierConstant(&parser.previous);
+    uint16_t global = fuser_globalSlot(&parser.previous);
     if (immutable) fuser_addGlobalImmutable(hash_generic(parser.previous.start, parser.previous.length));
     return global;  // and return the global
 }
@@ -141,9 +154,9 @@ static void fuser_namedVariable(Token name, bool canAssign, bool ignoreExpressio
         getOp = OP_GET_UPVALUE;
         setOp = OP_SET_UPVALUE;
     } else {
-        arg = fuser_identifierConstant(&name);
-        getOp = OP_GET_GLOBAL;
-        setOp = OP_SET_GLOBAL;
+        arg = fuser_globalSlot(&name);
+        getOp = OP_GET_GLOBAL_SLOT;
+        setOp = OP_SET_GLOBAL_SLOT;
     }
 
 // setting up a simple macro for ease of reading
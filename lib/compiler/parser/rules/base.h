@@ -11,8 +11,10 @@
 static void baseModel_method() {
     uint16_t constant = fuser_identifierConstant(&parser.previous);
     nuc_reaction(RT_REACTION);  // will be a default reaction
+    uint16_t cache = chunk_makeCache(OP_SET_BASE_PROPERTY, constant);
     EMIT_BYTE(OP_SET_BASE_PROPERTY);
     EMIT_UINT16(constant);
+    EMIT_UINT16(cache);
 }
 
 /** Parses and compiles a base model field. */
@@ -21,16 +23,18 @@ static void baseModel_field() {
     ADVANCE;     // eat the colon
     EXPRESSION;  // and the expression
     CONSUME(T_SEMICOLON, "Expected ';' after field declaration.");
+    uint16_t cache = chunk_makeCache(OP_SET_BASE_PROPERTY, constant);
     EMIT_BYTE(OP_SET_BASE_PROPERTY);
     EMIT_UINT16(constant);
+    EMIT_UINT16(cache);
 }
 
 /** Parses an inline model set by "{}"" */
 static void rule_baseModel(bool canAssign) {
     // call to get the base model object
     Token token = syntheticToken(T_IDENTIFIER, "Model");
-    uint16_t global = fuser_identifierConstant(&token);
-    EMIT_BYTE(OP_GET_GLOBAL);
+    uint16_t global = fuser_globalSlot(&token);
+    EMIT_BYTE(OP_GET_GLOBAL_SLOT);
     EMIT_UINT16(global);
     EMIT_SHORT(OP_CALL, 0);  // and call with ZERO arguments
 
@@ -33,16 +33,22 @@ static void rule_accessor(bool canAssign) {
 
     if (canAssign && MATCH(T_EQUAL)) {
         EXPRESSION;
+        uint16_t cache = chunk_makeCache(OP_SET_PROPERTY, name);
         EMIT_BYTE(OP_SET_PROPERTY);
         EMIT_UINT16(name);
+        EMIT_UINT16(cache);
     } else if (MATCH(T_LEFT_PAREN)) {
         uint8_t argCount = fuser_argumentList();
+        uint16_t cache = chunk_makeCache(OP_INVOKE, name);
         EMIT_BYTE(OP_INVOKE);
         EMIT_UINT16(name);
         EMIT_BYTE(argCount);
+        EMIT_UINT16(cache);
     } else {
+        uint16_t cache = chunk_makeCache(OP_GET_PROPERTY, name);
         EMIT_BYTE(OP_GET_PROPERTY);
         EMIT_UINT16(name);
+        EMIT_UINT16(cache);
     }
 }
 
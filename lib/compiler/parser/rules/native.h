@@ -4,12 +4,33 @@
 // Nucleus Headers
 #include "../declaration/variable.h"
 #include "../parser.h"
+#include "call.h"
 
-/** Parses a known Native as a GLOBAL identifier. */
+// FORWARD DECLARATIONS
+static int atomizer_findNative(const char* chars, int length);
+static bool atomizer_hasNativeFastCall(int index, int argCount);
+
+/**
+ * Parses a known Native. Natives are resolved to their index at compile time, and natives that are
+ * called straight away are called directly (without pushing the native as a callee). Natives with a
+ * typed entry point for the given arity are called through it instead.
+ */
 static void rule_native(bool canAssign) {
-    int constant = fuser_identifierConstant(&parser.previous);
-    EMIT_BYTE(OP_GET_NATIVE);
-    EMIT_UINT16(constant);
+    int native = atomizer_findNative(parser.previous.start, parser.previous.length);
+    if (native == -1) {
+        PARSER_ERROR_AT("Unknown standard library native.");
+        return;
+    }
+
+    if (MATCH(T_LEFT_PAREN)) {
+        uint8_t argCount = fuser_argumentList();
+        EMIT_BYTE(atomizer_hasNativeFastCall(native, argCount) ? OP_CALL_NATIVE_NUM : OP_CALL_NATIVE);
+        EMIT_UINT16(native);
+        EMIT_BYTE(argCount);
+    } else {
+        EMIT_BYTE(OP_GET_NATIVE);
+        EMIT_UINT16(native);
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -3,6 +3,7 @@
 
 // Nucleus Headers
 #include "../../emit.h"
+#include "../../optimiser/fold.h"
 #include "../parser.h"
 #include "precedence.h"
 
@@ -40,15 +41,44 @@ static void parser_forceOperation(TokenType op) {
     }
 }
 
+/**
+ * Folds a binary operation that was just emitted. Constant operands are replaced by the folded
+ * value, and identities (ie: `x * 1`) of numeric operands drop the operation entirely.
+ * @param lhs               Start of the left operand.
+ * @param rhs               Start of the right operand.
+ * @param end               End of the right operand (the operation follows).
+ */
+static void fuser_foldBinary(int lhs, int rhs, int end) {
+    nuc_Chunk* chunk = fuser_currentChunk();
+    if (chunk->count != end + 1) return;  // only single instruction operations are folded
+
+    // try folding constant operands first
+    uint8_t op = chunk->code[end];
+    nuc_Particle a, b, result;
+    bool isConstant = fold_constant(chunk, rhs, end, &b);
+    if (isConstant && fold_constant(chunk, lhs, rhs, &a) && fold_binary(op, a, b, &result)) {
+        chunk->count = end;
+        fold_truncate(chunk, lhs);
+        EMIT_CONST(result);
+    } else if (isConstant && fold_isIdentity(op, b) && fold_isNumeric(chunk, lhs, rhs)) {
+        chunk->count = end;
+        fold_truncate(chunk, rhs);
+    }
+}
+
 /** Parses a Binary Expression */
 static void rule_binary(bool canAssign) {
     // get the current operator, and required parsing rule
     TokenType op = parser.previous.type;
+    int lhs = current->operandStart;
+    int rhs = fuser_currentChunk()->count;
     nuc_ParseRule* rule = parser_getRule(op);
     fuser_parsePrecedence((Precedence)(rule->prec + 1));
 
     // and now emit an operation based on the operator
+    int end = fuser_currentChunk()->count;
     parser_forceOperation(op);
+    fuser_foldBinary(lhs, rhs, end);
 }
 
 /** Parses a unary expression. */
@@ -57,6 +87,7 @@ static void rule_unary(bool canAssign) {
     TokenType op = parser.previous.type;
 
     // compile the operand
+    int start = fuser_currentChunk()->count;
     fuser_parsePrecedence(P_UNARY);
 
     // and emit the unary operation
@@ -68,6 +99,15 @@ static void rule_unary(bool canAssign) {
         default:  // unreachable
             return;
     }
+
+    // folding constant operands
+    nuc_Chunk* chunk = fuser_currentChunk();
+    nuc_Particle a, result;
+    if (fold_constant(chunk, start, chunk->count - 1, &a) && fold_unary(chunk->code[chunk->count - 1], a, &result)) {
+        chunk->count--;
+        fold_truncate(chunk, start);
+        EMIT_CONST(result);
+    }
 }
 
 #endif
\ No newline at end of file
@@ -60,12 +60,14 @@ static void fuser_parsePrecedence(Precedence prec) {
     bool canAssign = prec <= P_ASSIGNMENT;
 
     // run the prefix rule
+    int start = fuser_currentChunk()->count;
     prefixRule(canAssign);
 
-    // and now check for infix
+    // and now check for infix (everything parsed so far is the left operand)
     while (prec <= parser_getRule(parser.current.type)->prec) {
         ADVANCE;
         nuc_ParseFunction infixRule = parser_getRule(parser.previous.type)->infix;
+        current->operandStart = start;
         infixRule(canAssign);
     }
 
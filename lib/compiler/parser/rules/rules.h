@@ -81,6 +81,7 @@ nuc_ParseRule rules[] = {
 
     // directives
     [T_MUTATE] = {NULL, NULL, P_NONE},
+    [T_REGISTER] = {NULL, NULL, P_NONE},
 
     // control tokens
     [T_IF] = {NULL, NULL, P_NONE},
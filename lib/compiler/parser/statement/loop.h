@@ -54,6 +54,107 @@ static TokenType fuser_eatForInitialiser() {
     return inclusivity;
 }
 
+/**
+ * Peeks past an optionally negated numeric literal.
+ * @param token             Current token, updated to the token following the literal.
+ */
+static inline bool fuser_peekNumericLiteral(Token* token) {
+    if (token->type == T_MINUS) *token = lexer_scan();
+    if (token->type != T_LIT_NUMBER) return false;
+    *token = lexer_scan();
+    return true;
+}
+
+/**
+ * Checks if the remaining 'for' clauses describe a numeric range. That is a limit that is either a
+ * local or a numeric literal, and a default or numeric literal step (that is added). The clauses are
+ * only peeked at, so the lexer is restored afterwards.
+ */
+static bool fuser_isNumericRange() {
+    Lexer saved = lexer;
+    Token token = parser.current;
+
+    // the limit is read live from a local, or is a literal
+    bool numeric;
+    if (token.type == T_IDENTIFIER && fuser_resolveLocal(current, &token) != -1) {
+        token = lexer_scan();
+        numeric = true;
+    } else {
+        numeric = fuser_peekNumericLiteral(&token);
+    }
+
+    // and the step may only be a literal
+    if (numeric && token.type == T_COMMA) {
+        token = lexer_scan();
+        if (token.type == T_LEFT_BRACE) {
+            numeric = lexer_scan().type == T_PLUS && lexer_scan().type == T_RIGHT_BRACE;
+            token = lexer_scan();
+        }
+        numeric = numeric && fuser_peekNumericLiteral(&token);
+    }
+
+    lexer = saved;
+    return numeric && token.type == T_RIGHT_PAREN;
+}
+
+/**
+ * Declares a hidden local holding the value at the top of the stack.
+ * @param name              Name of the hidden local (never a valid identifier).
+ */
+static int fuser_hiddenLocal(const char* name) {
+    fuser_addLocal(syntheticToken(T_IDENTIFIER, name), NUC_IMMUTABLE);
+    fuser_markInitialised();
+    return current->localCount - 1;
+}
+
+/**
+ * Compiles the remaining clauses and body of a numeric range 'for' loop. The limit and step are
+ * held in locals, so each iteration only runs the body and a single FOR_NUM_LOOP (which adds the
+ * step and jumps back whilst the variable differs from the limit).
+ * @param variable          Local slot of the loop variable.
+ */
+static void fuser_numericForStatement(int variable) {
+    // the limit is either an existing local (so changes in the body are seen), or a literal
+    int limit;
+    if (MATCH(T_IDENTIFIER)) {
+        limit = fuser_resolveLocal(current, &parser.previous);
+    } else {
+        EXPRESSION;
+        limit = fuser_hiddenLocal("(for limit)");
+    }
+
+    // the step defaults to one
+    if (MATCH(T_COMMA)) {
+        if (MATCH(T_LEFT_BRACE)) {  // can only be an explicit '+'
+            ADVANCE;
+            CONSUME(T_RIGHT_BRACE, "Expected '}' after specifying incrementor operator.");
+        }
+        EXPRESSION;
+    } else {
+        EMIT_CONST(NUC_NUM(1));
+    }
+    int step = fuser_hiddenLocal("(for step)");
+    CONSUME(T_RIGHT_PAREN, "Expected ')' after 'for' clauses.");
+
+    // skip the loop entirely if the variable already matches the limit
+    EMIT_BYTE(OP_FOR_NUM_PREP);
+    EMIT_UINT16(variable);
+    EMIT_UINT16(limit);
+    int exitJump = EMIT_JUMP_ADDR();
+    int bodyStart = fuser_currentChunk()->count;
+
+    // eat the for loop body, and step back to it
+    nuc_statement();
+    EMIT_BYTE(OP_FOR_NUM_LOOP);
+    EMIT_UINT16(variable);
+    EMIT_UINT16(limit);
+    EMIT_UINT16(step);
+    EMIT_LOOP_ADDR(bodyStart);
+
+    PATCH_JUMP(exitJump);
+    fuser_endScope();  // and end the for loop scope
+}
+
 /** Parses and Compiles a Nucleus For Statement */
 static void fuser_forStatement() {
     fuser_beginScope();  // to ensure loop variable is encapsulated
@@ -68,6 +169,7 @@ static void fuser_forStatement() {
     if (inclusivity == T_ERROR) return;  // do not continue
 
     // and now set the variable
+    int variable = current->localCount - 1;
     EXPRESSION;
 
     // now our loop ACTUALLY starts
@@ -82,6 +184,12 @@ static void fuser_forStatement() {
         CONSUME(T_RIGHT_BRACE, "Expected '}' after specifying loop comparator.");
     }
 
+    // numeric ranges are fused (custom comparators / incrementors take the generic form)
+    if (comparator == T_BANG_EQUAL && fuser_isNumericRange()) {
+        fuser_numericForStatement(variable);
+        return;
+    }
+
     // after the loop comparator should be the exitor value
     fuser_namedVariable(loopVariable, false, true);  // force a GET of the variable
     EXPRESSION;                                      // then the EXPRESSION
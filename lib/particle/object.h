@@ -4,6 +4,7 @@
 // Nucleus Headers
 #include "../common.h"
 #include "../utils/memory.h"
+#include "../vm/garbage/slab.h"
 #include "../vm/global.h"
 #include "objects/type.h"
 #include "value.h"
@@ -28,13 +29,10 @@
  * @param type              Internal object type.
  */
 nuc_Obj* obj_alloc(size_t size, nuc_ObjType type) {
-    nuc_Obj* obj = (nuc_Obj*)nuc_realloc(NULL, 0, size);
+    nuc_Obj* obj = nuc_allocObject(size);  // (starting in the nursery)
     obj->type = type;
-    obj->isMarked = false;
-
-    // set up singley linked objects list
-    obj->next = atomizer.objects;
-    atomizer.objects = obj;
+    obj->isOld = false;
+    obj->isRemembered = false;
 
 #ifdef NUC_DEBUG_GC  // display GC allocation
     printf("[\x1b[2;31mGC\x1b[0m] ");
@@ -59,43 +57,46 @@ static void obj_free(nuc_Obj* obj) {
     switch (obj->type) {
         case OBJ_STRING: {
             nuc_ObjString* string = (nuc_ObjString*)obj;
-            NUC_FREE_ARR(char, string->chars, string->length + 1);
-            NUC_FREE(nuc_ObjString, obj);
+            if (string->chars != NULL && string->chars != string->inlined) NUC_FREE_ARR(char, string->chars, string->length + 1);
+            nuc_freeObject(obj, objString_size(string));  // and the inline chars
         } break;
         case OBJ_REACTION: {
             nuc_ObjReaction* reac = (nuc_ObjReaction*)obj;
             chunk_free(&reac->chunk);
-            NUC_FREE(nuc_ObjReaction, reac);
+            regChunk_free(&reac->regs);
+            NUC_FREE_OBJ(nuc_ObjReaction, reac);
         } break;
         case OBJ_NATIVE: {
-            NUC_FREE(nuc_ObjNative, obj);
+            NUC_FREE_OBJ(nuc_ObjNative, obj);
         } break;
         case OBJ_CLOSURE: {
             nuc_ObjClosure* closure = (nuc_ObjClosure*)obj;
             NUC_FREE_ARR(nuc_ObjUpvalue*, closure->upvalues, closure->uvCount);
-            NUC_FREE(nuc_ObjClosure, obj);
+            NUC_FREE_OBJ(nuc_ObjClosure, obj);
         } break;
         case OBJ_UPVALUE: {
-            NUC_FREE(nuc_ObjUpvalue, obj);
+            NUC_FREE_OBJ(nuc_ObjUpvalue, obj);
         } break;
         case OBJ_MODEL: {
             nuc_ObjModel* model = (nuc_ObjModel*)obj;
             table_free(&model->methods);
             table_free(&model->defaults);
-            NUC_FREE(nuc_ObjModel, obj);
+            particleArr_free(&model->initialSlots);
+            shape_free(model->root);
+            NUC_FREE_OBJ(nuc_ObjModel, obj);
         } break;
         case OBJ_INSTANCE: {
             nuc_ObjInstance* inst = (nuc_ObjInstance*)obj;
-            table_free(&inst->fields);
-            NUC_FREE(nuc_ObjInstance, obj);
+            NUC_FREE_ARR(nuc_Particle, inst->slots, inst->capacity);
+            NUC_FREE_OBJ(nuc_ObjInstance, obj);
         } break;
         case OBJ_BOUND_METHOD: {
-            NUC_FREE(nuc_ObjBoundMethod, obj);
+            NUC_FREE_OBJ(nuc_ObjBoundMethod, obj);
         } break;
         case OBJ_ARRAY: {
             nuc_ObjArr* arr = (nuc_ObjArr*)obj;
             NUC_FREE_ARR(nuc_ObjArr*, arr->values, arr->capacity);
-            NUC_FREE(nuc_ObjArr, obj);
+            NUC_FREE_OBJ(nuc_ObjArr, obj);
         } break;
     }
 }
@@ -112,7 +113,7 @@ static bool obj_isEmpty(nuc_Obj* obj) {
         }
         case OBJ_INSTANCE: {  // can only be empty if derives from model literal
             nuc_ObjInstance* inst = (nuc_ObjInstance*)obj;
-            return inst->fields.count == 0 &&
+            return inst->shape->count == 0 &&
                    memcmp(inst->model->name->chars, "Model", 5);
         }
         case OBJ_ARRAY: {
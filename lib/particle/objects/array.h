@@ -48,6 +48,7 @@ nuc_ObjArr* objArr_new(nuc_ArrType type) {
  */
 void objArr_push(nuc_ObjArr* arr, nuc_Particle value) {
     NUC_GROW_ARR_IF(nuc_Particle, arr, values, GROW_DYNAMIC);  // grow the array if needed
+    gc_writeBarrier((nuc_Obj*)arr, value);                     // (after growing, as it may collect)
     arr->values[arr->count] = value;                           // save the new particle
     arr->count++;
 }
@@ -2,6 +2,7 @@
 #define NUC_OBJ_MODEL_H
 
 // Nucleus Headers
+#include "../shape.h"
 #include "../table.h"
 #include "type.h"
 
@@ -15,13 +16,18 @@ typedef struct {
     nuc_Table methods;
     nuc_Table defaults;
     nuc_ObjString* name;
+    nuc_Shape* root;                   // root of the instance shape tree
+    nuc_Shape* initial;                // shape of new instances (the defaults), NULL if stale
+    nuc_ParticleArr initialSlots;      // slot values of new instances
 } nuc_ObjModel;
 
 /** Nucleus Model Instance Structure */
 typedef struct {
     nuc_Obj obj;
     nuc_ObjModel* model;
-    nuc_Table fields;
+    nuc_Shape* shape;     // field layout of the instance
+    nuc_Particle* slots;  // field values (indexed by shape offset)
+    int capacity;         // allocated slots
 } nuc_ObjInstance;
 
 /** Structure to BIND Model methods when referenced outside of a Model Instance. */
@@ -44,24 +50,124 @@ typedef struct {
  * @param name              Name of model being defined.
  */
 nuc_ObjModel* model_new(nuc_ObjString* name) {
+    nuc_Shape* root = shape_new(NULL, NULL);  // allocated first, as the model is not yet reachable
     nuc_ObjModel* model = NUC_ALLOC_OBJ(nuc_ObjModel, OBJ_MODEL);
     model->name = name;
     table_init(&model->methods);
     table_init(&model->defaults);
+    model->root = root;
+    model->initial = NULL;
+    particleArr_init(&model->initialSlots);
+    root->model = (nuc_Obj*)model;
     return model;
 }
 
 /**
- * Constructs a new model instance.
+ * Sets a model default. New instances are laid out from the defaults, so this invalidates the
+ * initial instance shape of the model.
+ * @param model             Model to set default of.
+ * @param name              Name of default.
+ * @param value             Value of default.
+ */
+static inline void model_setDefault(nuc_ObjModel* model, nuc_ObjString* name, nuc_Particle value) {
+    gc_writeBarrier((nuc_Obj*)model, value);
+    table_set(&model->defaults, name, value);
+    model->initial = NULL;
+}
+
+/**
+ * Retrieves the initial shape of a models instances, laying the model defaults out along the
+ * shape tree if the defaults have changed since the last instance was made.
+ * @param model             Model to get initial shape of.
+ */
+static nuc_Shape* model_initialShape(nuc_ObjModel* model) {
+    if (model->initial != NULL) return model->initial;
+
+    // transition through every default, recording its value in slot order
+    nuc_Shape* shape = model->root;
+    model->initialSlots.count = 0;
+    for (int i = 0; i < model->defaults.capacity; i++) {
+        nuc_Entry* entry = &model->defaults.entries[i];
+        if (entry->key == NULL) continue;
+        shape = shape_transition(shape, entry->key);
+        particleArr_write(&model->initialSlots, entry->value);
+    }
+
+    model->initial = shape;
+    return shape;
+}
+
+/**
+ * Constructs a new model instance, with its fields initialised from the model defaults.
  * @param model             Base model to derive from.
  */
 nuc_ObjInstance* model_newInstance(nuc_ObjModel* model) {
+    nuc_Shape* shape = model_initialShape(model);
+
+    // allocate the slots BEFORE the instance (so a collection cannot see a partial instance)
+    nuc_Particle* slots = NULL;
+    if (shape->count > 0) {
+        slots = NUC_ALLOC(nuc_Particle, shape->count);
+        memcpy(slots, model->initialSlots.values, sizeof(nuc_Particle) * shape->count);
+    }
+
     nuc_ObjInstance* inst = NUC_ALLOC_OBJ(nuc_ObjInstance, OBJ_INSTANCE);
     inst->model = model;
-    table_init(&inst->fields);
+    inst->shape = shape;
+    inst->slots = slots;
+    inst->capacity = shape->count;
     return inst;
 }
 
+/**
+ * Gets an instance field.
+ * @param inst              Instance to get field of.
+ * @param name              Name of field.
+ * @param value             Pointer to store result to.
+ */
+static inline bool model_getField(nuc_ObjInstance* inst, nuc_ObjString* name, nuc_Particle* value) {
+    int offset = shape_lookup(inst->shape, name);
+    if (offset < 0) return false;
+    *value = inst->slots[offset];
+    return true;
+}
+
+/**
+ * Moves an instance to a shape one field larger than its current shape, growing its slots if needed.
+ * @param inst              Instance to transition.
+ * @param shape             Shape to transition to.
+ * @param value             Value of the new field.
+ */
+static inline void model_transitionField(nuc_ObjInstance* inst, nuc_Shape* shape, nuc_Particle value) {
+    if (inst->capacity < shape->count) {
+        int prev = inst->capacity;
+        int capacity = NUC_CAP_GROW_FAST(prev);
+        inst->slots = NUC_GROW_ARR(nuc_Particle, inst->slots, prev, capacity);
+        inst->capacity = capacity;
+    }
+
+    inst->slots[shape->count - 1] = value;
+    inst->shape = shape;
+}
+
+/**
+ * Sets an instance field, transitioning the instance shape if the field is new. The value should be
+ * reachable by the collector, as a new transition may allocate.
+ * @param inst              Instance to set field of.
+ * @param name              Name of field.
+ * @param value             Value of field.
+ */
+static inline void model_setField(nuc_ObjInstance* inst, nuc_ObjString* name, nuc_Particle value) {
+    gc_writeBarrier((nuc_Obj*)inst, value);
+    int offset = shape_lookup(inst->shape, name);
+    if (offset >= 0) {
+        inst->slots[offset] = value;
+        return;
+    }
+
+    model_transitionField(inst, shape_transition(inst->shape, name), value);
+}
+
 /**
  * Constructs a new bound model method.
  * @param receiver          Particle receiving reference to bound method.
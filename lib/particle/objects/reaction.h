@@ -3,6 +3,7 @@
 
 // Nucleus Headers
 #include "../../bytecode/chunk.h"
+#include "../../bytecode/registers.h"
 #include "../../utils/memory.h"
 #include "closure.h"
 #include "string.h"
@@ -26,12 +27,21 @@ typedef struct {
     int defaults;         // arguments defaulted
     int uvCount;          // upvalue counts
     nuc_Chunk chunk;      // compiled chunk
+    nuc_RegChunk regs;    // lowered register chunk
+    uint8_t tier;         // execution tier
     nuc_ObjString* name;  // reaction name
 } nuc_ObjReaction;
 
 // type definition for a Native Reaction
 typedef nuc_Particle (*nuc_NativeReaction)(int argCount, nuc_Particle* args);
 
+/** Typed (unboxed) entry points of a native by arity, taking and returning plain numerics. */
+typedef struct {
+    double (*num1)(double);                  // (double) -> double
+    double (*num2)(double, double);          // (double, double) -> double
+    double (*num3)(double, double, double);  // (double, double, double) -> double
+} nuc_NativeFastCall;
+
 /** Nucleus Native Reaction Object */
 typedef struct {
     nuc_Obj obj;
@@ -49,7 +59,9 @@ nuc_ObjReaction* reaction_new() {
     reaction->defaults = 0;
     reaction->uvCount = 0;
     reaction->name = NULL;
+    reaction->tier = NUC_TIER_STACK;
     chunk_init(&reaction->chunk);
+    regChunk_init(&reaction->regs);
     return reaction;
 }
 
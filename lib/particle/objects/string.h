@@ -10,6 +10,9 @@
 #include "../../vm/atomizer.h"
 #include "../../vm/disruptions/immediate.h"
 
+// minimum length of a concatenation to be built as a rope (shorter results are simply copied)
+#define NUC_ROPE_MIN_LENGTH 64
+
 /***************************
  *  OBJECT STRING METHODS  *
  ***************************/
@@ -20,43 +23,144 @@ static void atomizer_setIntern(nuc_ObjString* string);
 static inline nuc_ObjString* atomizer_getIntern(const char* chars, int length, uint32_t hash);
 
 /**
- * Allocates a string object into memory.
- * @param chars                 String for string object to own.
- * @param length                Length of string input.
- * @param hash                  String hash.
+ * Allocates a string object with room for its chars stored inline (so a string is only a single
+ * allocation), to be filled by the caller. The string is neither hashed nor interned, as strings
+ * produced at runtime (ie: by concatenation) are only interned if used as a key.
+ * @param length                Length of the chars.
  */
-static nuc_ObjString* objString_alloc(char* chars, int length, uint32_t hash) {
-    nuc_ObjString* string = NUC_ALLOC_OBJ(nuc_ObjString, OBJ_STRING);
+nuc_ObjString* objString_reserve(int length) {
+    nuc_ObjString* string = (nuc_ObjString*)obj_alloc(sizeof(nuc_ObjString) + length + 1, OBJ_STRING);
     string->length = length;
+    string->chars = string->inlined;
+    string->left = NULL;
+    string->right = NULL;
+    string->hash = 0;
+    string->hashed = false;
+    string->interned = false;
+    string->inlined[length] = '\0';
+    return string;
+}
+
+/**
+ * Retrieves the size of a string object (including any inline chars).
+ * @param string                String to size.
+ */
+static inline size_t objString_size(nuc_ObjString* string) {
+    return sizeof(nuc_ObjString) + (string->chars == string->inlined ? string->length + 1 : 0);
+}
+
+/**
+ * Flattens a rope into a single run of chars (once, as the rope then keeps the chars). The halves
+ * are walked with an explicit stack, so ropes built by long loops cannot overflow the C stack.
+ * Flattening never starts a collection, so strings can be flattened even whilst not reachable.
+ * @param string                String to flatten.
+ * @returns                     Chars of the string.
+ */
+static char* objString_flatten(nuc_ObjString* string) {
+    if (string->chars != NULL) return string->chars;
+
+    char* chars = (char*)nuc_allocQuiet(string->length + 1);
+
+    // fill the chars from the end (as ropes built by appending are deepest on the left)
+    nuc_ObjString** pending = NULL;
+    int count = 0, capacity = 0, end = string->length;
+    nuc_ObjString* node = string;
+    for (;;) {
+        if (node->chars != NULL) {
+            end -= node->length;
+            memcpy(chars + end, node->chars, node->length);
+            if (count == 0) break;
+            node = pending[--count];
+            continue;
+        }
+
+        // continue with the right half, leaving the left half until after
+        if (capacity < count + 1) {
+            capacity = NUC_CAP_GROW_FAST(capacity);
+            pending = (nuc_ObjString**)realloc(pending, sizeof(nuc_ObjString*) * capacity);
+            if (pending == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not allocate space for a string.");
+        }
+
+        pending[count++] = node->left;
+        node = node->right;
+    }
+
+    free(pending);
+    chars[string->length] = '\0';
     string->chars = chars;
-    string->hash = hash;
+    string->left = NULL;  // and let the halves be collected
+    string->right = NULL;
+    return chars;
+}
+
+/**
+ * Retrieves the hash of a string, computing it on first use.
+ * @param string                String to hash.
+ */
+static inline uint32_t objString_hash(nuc_ObjString* string) {
+    if (!string->hashed) {
+        string->hash = hash_generic(objString_flatten(string), string->length);
+        string->hashed = true;
+    }
+
+    return string->hash;
+}
+
+/**
+ * Retrieves the intern of a string, interning the string if its chars have no intern yet. Strings
+ * must be interned before being used as table keys (as tables compare keys by identity).
+ * @param string                String to intern.
+ */
+static nuc_ObjString* objString_intern(nuc_ObjString* string) {
+    if (string->interned) return string;
+
+    // a matching intern replaces the string
+    uint32_t hash = objString_hash(string);
+    nuc_ObjString* interned = atomizer_getIntern(string->chars, string->length, hash);
+    if (interned != NULL) return interned;
+
+    // otherwise the string becomes the intern
+    string->interned = true;
     atomizer_setIntern(string);
     return string;
 }
 
+/**
+ * Checks if two strings have the same chars. Interns are unique so compare by identity, otherwise
+ * the chars are compared (hashes are only compared when both are already known).
+ * @param a                     String A to compare.
+ * @param b                     String B to compare.
+ */
+static inline bool objString_equals(nuc_ObjString* a, nuc_ObjString* b) {
+    if (a == b) return true;
+    if (a->interned && b->interned) return false;
+    if (a->length != b->length) return false;
+    if (a->hashed && b->hashed && a->hash != b->hash) return false;
+    return memcmp(objString_flatten(a), objString_flatten(b), a->length) == 0;
+}
+
 /**
  * Unescapes a given input string.
  * @param chars             String to unescape.
- * @param length            Length of input string.
+ * @param length            Length of input string (updated to the unescaped length).
+ * @returns                 Unescaped chars (the input chars if nothing was escaped).
  */
 static char* objString_unescape(const char* chars, int* length) {
     // initially check if the '\' character even exists
-    if (strchr(chars, '\\') == NULL) return (char*)chars;
+    if (memchr(chars, '\\', *length) == NULL) return (char*)chars;
 
 // switch case helper
-#define CASE_UNESCAPE(c, hex)       \
-    case c:                         \
-        strncat(unescaped, hex, 1); \
-        newLen++;                   \
+#define CASE_UNESCAPE(c, hex)          \
+    case c:                            \
+        unescaped[newLen++] = hex[0];  \
         break;
 
     char* unescaped = NUC_ALLOC(char, *length + 1);  // preempt a size and alloc
     int newLen = 0;                                  // and set a new length
     for (int i = 0; i < *length; i++) {
-        if (chars[i] != '\\') {                // if not '\'
-            strncat(unescaped, &chars[i], 1);  // then concat
-            newLen++;                          // then increment the new length
-            continue;                          // and continue
+        if (chars[i] != '\\') {               // if not '\'
+            unescaped[newLen++] = chars[i];  // then copy
+            continue;                        // and continue
         }
 
         // otherwise handle string escape sequences
@@ -74,12 +178,9 @@ static char* objString_unescape(const char* chars, int* length) {
             CASE_UNESCAPE('?', "\?");  // single char escape sequences
 
             case 'x': {  // byte escape sequence
-                char hex[2];
-                hex[0] = chars[++i];
-                hex[1] = chars[++i];
-                long byte = strtol(hex, NULL, 16);
-                strncat(unescaped, (char*)&byte, 1);
-                newLen++;  // and increment the length by 1                           // waste a char as expect two
+                char hex[3] = {chars[i + 1], chars[i + 2], '\0'};
+                i += 2;  // waste a char as expect two
+                unescaped[newLen++] = (char)strtol(hex, NULL, 16);
             } break;
 
             default:  // want to error out on other escapes
@@ -89,57 +190,89 @@ static char* objString_unescape(const char* chars, int* length) {
         }
     }
 
-    // if now same length, then can ignore change
-    if (newLen == *length) return (char*)chars;
-
-    // otherwise need to modify the length
-    length = &newLen;
-    unescaped[newLen] = '\0';                           // terminate
-    unescaped = (char*)realloc(unescaped, newLen + 1);  // and realloc size
+    // and update the length
+    unescaped[newLen] = '\0';
+    *length = newLen;
     return unescaped;
 
 // undefining the switch case
-#undef CASE_UNSESCAPE
+#undef CASE_UNESCAPE
 }
 
 /**
- * Creates a string object from given series of characters.
- * @param input             Chars to convert to string object.
- * @param inLen             Length of input string.
+ * Creates an interned string object from given chars (without unescaping them).
+ * @param chars             Chars to copy.
+ * @param length            Length of chars.
  */
-nuc_ObjString* objString_copy(const char* input, int inLen) {
-    // want to initially UNESCAPE an input string
-    int length = inLen;
-    const char* chars = objString_unescape(input, &length);
+nuc_ObjString* objString_copyChars(const char* chars, int length) {
     uint32_t hash = hash_generic(chars, length);
 
     // if a string intern is found, return it instead
     nuc_ObjString* interned = atomizer_getIntern(chars, length, hash);
     if (interned != NULL) return interned;
 
-    char* heapChars = NUC_ALLOC(char, length + 1);
-    memcpy(heapChars, chars, length);
-    heapChars[length] = '\0';
-    return objString_alloc(heapChars, length, hash);
+    nuc_ObjString* string = objString_reserve(length);
+    memcpy(string->inlined, chars, length);
+    string->hash = hash;
+    string->hashed = true;
+    string->interned = true;
+    atomizer_setIntern(string);
+    return string;
 }
 
 /**
- * Claims ownership of a string to a string object.
+ * Creates a string object from given series of characters.
+ * @param input             Chars to convert to string object.
+ * @param inLen             Length of input string.
+ */
+nuc_ObjString* objString_copy(const char* input, int inLen) {
+    // want to initially UNESCAPE an input string
+    int length = inLen;
+    char* chars = objString_unescape(input, &length);
+    nuc_ObjString* string = objString_copyChars(chars, length);
+    if (chars != input) NUC_FREE_ARR(char, chars, inLen + 1);
+    return string;
+}
+
+/**
+ * Claims ownership of a string to a string object. The chars are copied inline, so are freed.
  * @param chars             Chars to claim ownership of.
  * @param length            Length of string.
  */
 nuc_ObjString* objString_take(char* chars, int length) {
-    uint32_t hash = hash_generic(chars, length);
+    nuc_ObjString* string = objString_copyChars(chars, length);
+    NUC_FREE_ARR(char, chars, length + 1);
+    return string;
+}
 
-    // if a string intern is found, claim ownership
-    nuc_ObjString* interned = atomizer_getIntern(chars, length, hash);
-    if (interned != NULL) {
-        NUC_FREE_ARR(char, chars, length + 1);
-        return interned;
-    }
+/**
+ * Copies chars produced at runtime into a string WITHOUT interning it.
+ * @param chars             Chars to copy.
+ * @param length            Length of chars.
+ */
+nuc_ObjString* objString_copyLazy(const char* chars, int length) {
+    nuc_ObjString* string = objString_reserve(length);
+    memcpy(string->inlined, chars, length);
+    return string;
+}
 
-    // and return the allocation
-    return objString_alloc(chars, length, hash);
+/**
+ * Concatenates two strings as a rope, deferring the copy of their chars until the chars are
+ * needed (so strings built by appending in a loop are copied once, rather than at every step).
+ * Both halves must be reachable by the garbage collector.
+ * @param left              Left half of the rope.
+ * @param right             Right half of the rope.
+ */
+nuc_ObjString* objString_rope(nuc_ObjString* left, nuc_ObjString* right) {
+    nuc_ObjString* string = NUC_ALLOC_OBJ(nuc_ObjString, OBJ_STRING);
+    string->length = left->length + right->length;
+    string->chars = NULL;
+    string->left = left;
+    string->right = right;
+    string->hash = 0;
+    string->hashed = false;
+    string->interned = false;
+    return string;
 }
 
 #endif
\ No newline at end of file
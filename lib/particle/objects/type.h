@@ -21,19 +21,33 @@ typedef enum {
 
 /** Generic Object Structure */
 typedef struct nuc_Obj {
-    nuc_ObjType type;      // type of object
-    bool isMarked;         // if an object is marked safe from gc
-    struct nuc_Obj* next;  // pointer to next object on heap
+    nuc_ObjType type;   // type of object
+    bool isOld;         // if an object has survived a collection (so is no longer in the nursery)
+    bool isRemembered;  // if an old object may reference young objects
+    bool isLarge;       // if an object is too large for the slabs (so has its mark in a header)
 } nuc_Obj;
 
 /** Nucleus String Object */
-typedef struct {
+typedef struct nuc_ObjString {
     nuc_Obj obj;
     int length;
-    char* chars;
-    uint32_t hash;
+    char* chars;                  // chars of the string (NULL for a rope until flattened)
+    struct nuc_ObjString* left;   // left half of a rope (until flattened)
+    struct nuc_ObjString* right;  // right half of a rope (until flattened)
+    uint32_t hash;                // hash of the chars (only valid once hashed)
+    bool hashed;                  // if the hash has been computed
+    bool interned;                // if the string is the intern of its chars
+    char inlined[];               // chars stored with the string (unless a rope)
 } nuc_ObjString;  // this one needs to be declared here
 
+// forward declaration of string flattening / write barrier actions
+static char* objString_flatten(nuc_ObjString* string);
+static void gc_remember(nuc_Obj* object);
+static void gc_shade(nuc_Obj* owner, nuc_Obj* object);
+
+// if a major collection is marking (so written objects may need shading)
+static bool gc_marking = false;
+
 /****************************
  *  GENERIC OBJECT HELPERS  *
  ****************************/
@@ -47,6 +61,31 @@ static inline bool nuc_isObjType(nuc_Particle value, nuc_ObjType type) {
     return IS_OBJ(value) && AS_OBJ(value)->type == type;
 }
 
+/**
+ * Write barrier for storing a particle into an object. Old objects given a reference to a young
+ * object are remembered, as minor collections only trace the nursery. Whilst a major collection is
+ * marking, white objects stored into marked objects are shaded (so no black object refers to a
+ * white object).
+ * @param owner             Object being written to.
+ * @param value             Particle being stored.
+ */
+static inline void gc_writeBarrier(nuc_Obj* owner, nuc_Particle value) {
+    if (!IS_OBJ(value)) return;
+    nuc_Obj* object = AS_OBJ(value);
+    if (owner->isOld && !owner->isRemembered && !object->isOld) gc_remember(owner);
+    if (gc_marking) gc_shade(owner, object);
+}
+
+/**
+ * Write barrier for bulk writes into an object (ie: copying tables). The object is remembered if
+ * old, and traced again if already marked.
+ * @param owner             Object being written to.
+ */
+static inline void gc_writeBarrierAll(nuc_Obj* owner) {
+    if (owner->isOld && !owner->isRemembered) gc_remember(owner);
+    if (gc_marking) gc_shade(owner, owner);
+}
+
 /** Macro for getting the Object Type */
 #define OBJ_TYPE(value) (AS_OBJ(value)->type)
 
@@ -69,7 +108,7 @@ static inline bool nuc_isObjType(nuc_Particle value, nuc_ObjType type) {
 #define AS_REACTION(value) ((nuc_ObjReaction*)AS_OBJ(value))
 #define AS_NATIVE(value) (((nuc_ObjNative*)AS_OBJ(value))->reaction)
 #define AS_STRING(value) ((nuc_ObjString*)AS_OBJ(value))
-#define AS_CSTRING(value) (((nuc_ObjString*)AS_OBJ(value))->chars)
+#define AS_CSTRING(value) objString_flatten((nuc_ObjString*)AS_OBJ(value))
 
 /**
  * Allocates a Nucleus object to memory.
@@ -78,4 +117,11 @@ static inline bool nuc_isObjType(nuc_Particle value, nuc_ObjType type) {
  */
 #define NUC_ALLOC_OBJ(type, objType) (type*)obj_alloc(sizeof(type), objType)
 
+/**
+ * Frees the storage of a Nucleus object.
+ * @param type              Type of Nucleus object.
+ * @param obj               Object to free.
+ */
+#define NUC_FREE_OBJ(type, obj) nuc_freeObject((nuc_Obj*)(obj), sizeof(type))
+
 #endif
\ No newline at end of file
@@ -0,0 +1,104 @@
+#ifndef NUC_SHAPE_H
+#define NUC_SHAPE_H
+
+// Nucleus Headers
+#include "../common.h"
+#include "../utils/memory.h"
+#include "table.h"
+
+/***********************
+ *  SHAPE DEFINITIONS  *
+ ***********************/
+
+/**
+ * Nucleus Hidden Class Shape. A shape describes the field layout of model instances, mapping each
+ * field name to an offset in the instance slot array. Shapes form a transition tree rooted at their
+ * model: adding a field moves an instance to the child shape for that name, so instances that are
+ * built the same way share the same shape.
+ */
+typedef struct nuc_Shape {
+    struct nuc_Shape* parent;     // shape this one transitioned from (NULL for a root)
+    nuc_Obj* model;               // model owning the transition tree
+    nuc_ObjString* name;          // field added by the transition (NULL for a root)
+    int count;                    // slots held by instances of this shape
+    nuc_Table slots;              // field name => slot offset (numeric)
+    struct nuc_Shape** children;  // transitions out of this shape
+    int childCount;
+    int childCapacity;
+} nuc_Shape;
+
+/*******************
+ *  SHAPE METHODS  *
+ *******************/
+
+/**
+ * Allocates a new empty shape.
+ * @param parent            Parent shape (or NULL for a root).
+ * @param model             Model owning the shape tree.
+ */
+static nuc_Shape* shape_new(nuc_Shape* parent, nuc_Obj* model) {
+    nuc_Shape* shape = NUC_ALLOC(nuc_Shape, 1);
+    shape->parent = parent;
+    shape->model = model;
+    shape->name = NULL;
+    shape->count = 0;
+    table_init(&shape->slots);
+    shape->children = NULL;
+    shape->childCount = 0;
+    shape->childCapacity = 0;
+    return shape;
+}
+
+/**
+ * Frees a shape and all of its transitions.
+ * @param shape             Shape to free.
+ */
+static void shape_free(nuc_Shape* shape) {
+    for (int i = 0; i < shape->childCount; i++) shape_free(shape->children[i]);
+    NUC_FREE_ARR(nuc_Shape*, shape->children, shape->childCapacity);
+    table_free(&shape->slots);
+    NUC_FREE(nuc_Shape, shape);
+}
+
+/**
+ * Retrieves the slot offset of a field within a shape.
+ * @param shape             Shape to search.
+ * @param name              Field name.
+ * @returns                 Slot offset, or -1 if the shape does not hold the field.
+ */
+static inline int shape_lookup(nuc_Shape* shape, nuc_ObjString* name) {
+    nuc_Particle offset;
+    if (!table_get(&shape->slots, name, &offset)) return -1;
+    return (int)AS_NUMBER(offset);
+}
+
+/**
+ * Retrieves the shape reached by adding a field to a given shape, creating the transition if it
+ * has not been taken before. The caller must ensure the field is not already part of the shape.
+ * @param shape             Shape to transition from.
+ * @param name              Field being added.
+ */
+static nuc_Shape* shape_transition(nuc_Shape* shape, nuc_ObjString* name) {
+    for (int i = 0; i < shape->childCount; i++) {
+        if (shape->children[i]->name == name) return shape->children[i];
+    }
+
+    // build the child fully BEFORE linking it (allocations may collect garbage)
+    nuc_Shape* child = shape_new(shape, shape->model);
+    child->name = name;
+    child->count = shape->count + 1;
+    table_addAll(&shape->slots, &child->slots);
+    table_set(&child->slots, name, NUC_NUM(shape->count));
+
+    // and link it as a transition
+    if (shape->childCapacity < shape->childCount + 1) {
+        int prev = shape->childCapacity;
+        shape->childCapacity = NUC_CAP_GROW_FAST(prev);
+        shape->children = NUC_GROW_ARR(nuc_Shape*, shape->children, prev, shape->childCapacity);
+    }
+    shape->children[shape->childCount++] = child;
+    if (shape->model != NULL) gc_writeBarrier(shape->model, NUC_OBJ(name));  // names are marked through the model
+    return child;
+}
+
+#endif
@@ -165,6 +165,21 @@ bool table_get(nuc_Table* table, nuc_ObjString* key, nuc_Particle* value) {
     return true;
 }
 
+/**
+ * Retrieves the entry index of a key within a table. Indices stay valid until the table grows.
+ * @param table             Table to search.
+ * @param key               Key to find.
+ * @returns                 Entry index, or -1 if the key is not present.
+ */
+int table_indexOf(nuc_Table* table, nuc_ObjString* key) {
+    if (table->count == 0) return -1;  // no values
+
+    // search for the entry
+    nuc_Entry* entry = table_findEntry(table->entries, table->capacity, key);
+    if (entry->key == NULL) return -1;  // no match
+    return (int)(entry - table->entries);
+}
+
 /**
  * Finds a string from hash table strings.
  * @param table             Table to search keys of.
@@ -180,16 +195,15 @@ nuc_ObjString* table_findString(nuc_Table* table, const char* chars, int length,
     for (;;) {
         nuc_Entry* entry = &table->entries[index];
 
-        // stop if we find an empty non-tombstone entry
-        if (entry->key == NULL && IS_NULL(entry->value)) {
-            return NULL;
+        if (entry->key == NULL) {
+            // stop if we find an empty non-tombstone entry (tombstones are skipped over)
+            if (IS_NULL(entry->value)) return NULL;
+        } else if (entry->key->length == length &&
+                   entry->key->hash == hash &&
+                   memcmp(entry->key->chars, chars, length) == 0) {
+            return entry->key;  // otherwise check if strings match
         }
 
-        // otherwise check if strings match
-        if (entry->key->length == length &&
-            entry->key->hash == hash &&
-            memcmp(entry->key->chars, chars, length) == 0) return entry->key;
-
         // continue iterating
         index = (index + 1) & (table->capacity - 1);
     }
@@ -25,6 +25,7 @@ typedef uint64_t nuc_Particle;
 #define TAG_NULL 1
 #define TAG_FALSE 2
 #define TAG_TRUE 3
+#define TAG_UNDEFINED 4  // internal marker only, never visible to scripts
 
 // immutability booleans
 #define NUC_MUTABLE false
@@ -59,6 +60,7 @@ static inline double particleToNum(nuc_Particle value) {
 #define NUC_NULL ((nuc_Particle)(uint64_t)(QNAN | TAG_NULL))
 #define NUC_FALSE ((nuc_Particle)(uint64_t)(QNAN | TAG_FALSE))
 #define NUC_TRUE ((nuc_Particle)(uint64_t)(QNAN | TAG_TRUE))
+#define NUC_UNDEFINED ((nuc_Particle)(uint64_t)(QNAN | TAG_UNDEFINED))
 #define NUC_BOOL(b) ((b) ? NUC_TRUE : NUC_FALSE)
 #define NUC_OBJ(obj) \
     (nuc_Particle)(SIGN_BIT | QNAN | (uint64_t)(uintptr_t)(obj))
@@ -72,6 +74,7 @@ static inline double particleToNum(nuc_Particle value) {
 // checking
 #define IS_NUMBER(value) (((value)&QNAN) != QNAN)
 #define IS_NULL(value) ((value) == NUC_NULL)
+#define IS_UNDEFINED(value) ((value) == NUC_UNDEFINED)
 #define IS_BOOL(value) (((value) | 1) == NUC_TRUE)
 #define IS_OBJ(value) \
     (((value) & (QNAN | SIGN_BIT)) == (QNAN | SIGN_BIT))
@@ -36,7 +36,7 @@ NUC_NATIVE_WRAPPER(
 
     // exporting the throw methods
     #define NUC_STDLIB__THROW_DISP \
-        {"std.throw", nuc_std__throw},
+        NUC_NATIVE_EXPORT("std.throw", nuc_std__throw),
 
 #endif
 
@@ -0,0 +1,97 @@
+#ifndef NUC_STDLIB_GC_H
+#define NUC_STDLIB_GC_H
+
+#ifdef NUC_NTVDEF_GC
+
+    // Nucleus Headers
+    #include "../../vm/garbage/collection.h"
+    #include "../../vm/global.h"
+    #include "../helpers.h"
+
+/****************
+ *  GC NATIVES  *
+ ****************/
+
+/** Returns the count of minor collections (of the nursery) so far. */
+NUC_NATIVE_WRAPPER(
+    gc,                                      // parent
+    minor,                                   // native name
+    return NUC_NUM(atomizer.gcStats.minor))  // method
+
+/** Returns the count of major collections (of every object) so far. */
+NUC_NATIVE_WRAPPER(
+    gc,                                      // parent
+    major,                                   // native name
+    return NUC_NUM(atomizer.gcStats.major))  // method
+
+/** Returns the count of slices run by major collections so far. */
+NUC_NATIVE_WRAPPER(
+    gc,                                       // parent
+    slices,                                   // native name
+    return NUC_NUM(atomizer.gcStats.slices))  // method
+
+/** Returns the total time spent collecting garbage (in microseconds). */
+NUC_NATIVE_WRAPPER(
+    gc,                                           // parent
+    pause,                                        // native name
+    return NUC_NUM(atomizer.gcStats.pauseTotal))  // method
+
+/** Returns the longest single pause (in microseconds). */
+NUC_NATIVE_WRAPPER(
+    gc,                                         // parent
+    maxPause,                                   // native name
+    return NUC_NUM(atomizer.gcStats.pauseMax))  // method
+
+/** Returns the total time spent marking by major collections (in microseconds). */
+NUC_NATIVE_WRAPPER(
+    gc,                                          // parent
+    markTime,                                    // native name
+    return NUC_NUM(atomizer.gcStats.markTotal))  // method
+
+/** Runs a whole major collection at once. */
+NUC_NATIVE_WRAPPER(
+    gc,                     // parent
+    collect,                // native name
+    gc_finishCollection();  // method
+    gc_collect();
+    return NUC_NULL)
+
+/** Sets the objects traced / swept by each slice of a major collection, returning the previous budget. */
+NUC_NATIVE_WRAPPER(
+    gc,                                       // parent
+    budget,                                   // native name
+    NUC_STDLIB_EXPECT_ONE_ARG(budget);        // method
+    NUC_STDLIB_EXPECT_NUM(args[0], budget);
+    int previous = atomizer.sliceWork;
+    if (AS_NUMBER(args[0]) >= 1) atomizer.sliceWork = (int)AS_NUMBER(args[0]);
+    return NUC_NUM(previous))
+
+/** Sets the workers marking in parallel, returning the previous count. */
+NUC_NATIVE_WRAPPER(
+    gc,                                  // parent
+    workers,                             // native name
+    NUC_STDLIB_EXPECT_ONE_ARG(workers);  // method
+    NUC_STDLIB_EXPECT_NUM(args[0], workers);
+    int previous = atomizer.gcWorkers;
+    if (AS_NUMBER(args[0]) >= 1) atomizer.gcWorkers = AS_NUMBER(args[0]) < NUC_GC_MAX_WORKERS ? (int)AS_NUMBER(args[0]) : NUC_GC_MAX_WORKERS;
+    return NUC_NUM(previous))
+
+    /*************
+     *  EXPORTS  *
+     *************/
+
+    // exports all the GC methods
+    #define NUC_STDLIB__GC_NATIVES                              \
+        NUC_NATIVE_EXPORT("std.gc.minor", nuc_gc__minor),       \
+        NUC_NATIVE_EXPORT("std.gc.major", nuc_gc__major),       \
+        NUC_NATIVE_EXPORT("std.gc.slices", nuc_gc__slices),     \
+        NUC_NATIVE_EXPORT("std.gc.pause", nuc_gc__pause),       \
+        NUC_NATIVE_EXPORT("std.gc.maxPause", nuc_gc__maxPause), \
+        NUC_NATIVE_EXPORT("std.gc.markTime", nuc_gc__markTime), \
+        NUC_NATIVE_EXPORT("std.gc.collect", nuc_gc__collect),   \
+        NUC_NATIVE_EXPORT("std.gc.budget", nuc_gc__budget),     \
+        NUC_NATIVE_EXPORT("std.gc.workers", nuc_gc__workers)
+
+#endif
+
+#endif
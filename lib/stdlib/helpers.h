@@ -19,6 +19,19 @@
         __VA_ARGS__;                                                                        \
     }
 
+/**
+ * Wraps a typed native entry point. These take and return plain numerics, so can be called
+ * straight from the atomizer once the arguments are known to be numeric.
+ * @param PARENT                Parent library name.
+ * @param METHOD                Method name.
+ * @param PARAMS                Parameter list of the entry point.
+ * @param RESULT                Result expression of the entry point.
+ */
+#define NUC_NATIVE_FAST_WRAPPER(PARENT, METHOD, PARAMS, RESULT) \
+    static double nuc_##PARENT##__##METHOD##__fast PARAMS {     \
+        return RESULT;                                         \
+    }
+
 /**********************
  *  EXPECTING MACROS  *
  **********************/
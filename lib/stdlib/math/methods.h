@@ -17,26 +17,36 @@
      * Defines a single argument math method.
      * @param METHOD                Native math method.
      */
-    #define NUC_MATH_ONE_ARG(METHOD)                \
-        NUC_NATIVE_WRAPPER(                         \
-            math,                                   \
-            METHOD,                                 \
-            NUC_STDLIB_EXPECT_ONE_ARG(METHOD);      \
-            NUC_STDLIB_EXPECT_NUM(args[0], METHOD); \
-            return NUC_NUM(METHOD(AS_NUMBER(args[0]))))
+    #define NUC_MATH_ONE_ARG(METHOD)                    \
+        NUC_NATIVE_WRAPPER(                             \
+            math,                                       \
+            METHOD,                                     \
+            NUC_STDLIB_EXPECT_ONE_ARG(METHOD);          \
+            NUC_STDLIB_EXPECT_NUM(args[0], METHOD);     \
+            return NUC_NUM(METHOD(AS_NUMBER(args[0])))) \
+        NUC_NATIVE_FAST_WRAPPER(math, METHOD, (double a), METHOD(a))
 
     /**
      * Defines a two argument math methods.
      * @param METHOD                Native math method.
      */
-    #define NUC_MATH_TWO_ARGS(METHOD)               \
-        NUC_NATIVE_WRAPPER(                         \
-            math,                                   \
-            METHOD,                                 \
-            NUC_STDLIB_EXPECT_ARGS(2, METHOD);      \
-            NUC_STDLIB_EXPECT_NUM(args[0], METHOD); \
-            NUC_STDLIB_EXPECT_NUM(args[1], METHOD); \
-            return NUC_NUM(METHOD(AS_NUMBER(args[0]), AS_NUMBER(args[1]))))
+    #define NUC_MATH_TWO_ARGS(METHOD)                                       \
+        NUC_NATIVE_WRAPPER(                                                 \
+            math,                                                           \
+            METHOD,                                                         \
+            NUC_STDLIB_EXPECT_ARGS(2, METHOD);                              \
+            NUC_STDLIB_EXPECT_NUM(args[0], METHOD);                         \
+            NUC_STDLIB_EXPECT_NUM(args[1], METHOD);                         \
+            return NUC_NUM(METHOD(AS_NUMBER(args[0]), AS_NUMBER(args[1])))) \
+        NUC_NATIVE_FAST_WRAPPER(math, METHOD, (double a, double b), METHOD(a, b))
+
+    /**
+     * Exports a math native along with its typed entry point.
+     * @param METHOD                Native math method.
+     * @param ARITY                 Arity of the typed entry point (1 => num1, ...).
+     */
+    #define NUC_MATH_EXPORT(METHOD, ARITY) \
+        { "math." #METHOD, nuc_math__##METHOD, {.num##ARITY = nuc_math__##METHOD##__fast} }
 
 /**
  * Custom __builtin_clz method.
@@ -110,6 +120,7 @@ NUC_NATIVE_WRAPPER(
     NUC_STDLIB_EXPECT_ONE_ARG("abs");
     NUC_STDLIB_EXPECT_NUM(args[0], METHOD);
     return NUC_NUM(fabs(AS_NUMBER(args[0]))))
+NUC_NATIVE_FAST_WRAPPER(math, abs, (double a), fabs(a))
 
 // "hypot" takes in numerous arguments
 NUC_NATIVE_WRAPPER(
@@ -127,6 +138,8 @@ NUC_NATIVE_WRAPPER(
 
     /** Return the SQUARE ROOT of the SUM of SQUARES */
     return NUC_NUM(sqrt(sos)))
+NUC_NATIVE_FAST_WRAPPER(math, hypot2, (double a, double b), sqrt(a * a + b * b))
+NUC_NATIVE_FAST_WRAPPER(math, hypot3, (double a, double b, double c), sqrt(a * a + b * b + c * c))
 
 // need to cast to integers for integer multiplicaltion
 NUC_NATIVE_WRAPPER(
@@ -136,6 +149,7 @@ NUC_NATIVE_WRAPPER(
     NUC_STDLIB_EXPECT_NUM(args[0], "imul");
     NUC_STDLIB_EXPECT_NUM(args[1], "imul");
     return NUC_NUM((int)AS_NUMBER(args[0]) * (int)AS_NUMBER(args[1])))
+NUC_NATIVE_FAST_WRAPPER(math, imul, (double a, double b), (int)a * (int)b)
 
 // coordinates "signum" method which will be -1, 0, or 1
 NUC_NATIVE_WRAPPER(
@@ -145,44 +159,46 @@ NUC_NATIVE_WRAPPER(
     NUC_STDLIB_EXPECT_NUM(args[0], "signum");
     double tmp = AS_NUMBER(args[0]);
     return NUC_NUM((tmp > 0) - (tmp < 0)))
+NUC_NATIVE_FAST_WRAPPER(math, signum, (double a), (a > 0) - (a < 0))
 
     /*************
      *  EXPORTS  *
      *************/
 
-    // exporting the MATH NATIVE methods
-    #define NUC_STDLIB__MATH_NATIVES           \
-        {"math.abs", nuc_math__abs},           \
-            {"math.acos", nuc_math__acos},     \
-            {"math.acosh", nuc_math__acosh},   \
-            {"math.asin", nuc_math__asin},     \
-            {"math.asinh", nuc_math__asinh},   \
-            {"math.atan", nuc_math__atan},     \
-            {"math.atanh", nuc_math__atanh},   \
-            {"math.atan2", nuc_math__atan2},   \
-            {"math.cbrt", nuc_math__cbrt},     \
-            {"math.ceil", nuc_math__ceil},     \
-            {"math.clz32", nuc_math__clz32},   \
-            {"math.cos", nuc_math__cos},       \
-            {"math.cosh", nuc_math__cosh},     \
-            {"math.exp", nuc_math__exp},       \
-            {"math.expm1", nuc_math__expm1},   \
-            {"math.floor", nuc_math__floor},   \
-            {"math.hypot", nuc_math__hypot},   \
-            {"math.imul", nuc_math__imul},     \
-            {"math.log1p", nuc_math__log},     \
-            {"math.log10", nuc_math__log10},   \
-            {"math.log2", nuc_math__log2},     \
-            {"math.pow", nuc_math__pow},       \
-            {"math.round", nuc_math__round},   \
-            {"math.roundf", nuc_math__roundf}, \
-            {"math.signum", nuc_math__signum}, \
-            {"math.sin", nuc_math__sin},       \
-            {"math.sinh", nuc_math__sinh},     \
-            {"math.sqrt", nuc_math__sqrt},     \
-            {"math.tan", nuc_math__tan},       \
-            {"math.tanh", nuc_math__tanh},     \
-        { "math.trunc", nuc_math__trunc }
+    // exporting the MATH NATIVE methods (with their typed entry points)
+    #define NUC_STDLIB__MATH_NATIVES                                                                       \
+        NUC_MATH_EXPORT(abs, 1),                                                                           \
+        NUC_MATH_EXPORT(acos, 1),                                                                          \
+        NUC_MATH_EXPORT(acosh, 1),                                                                         \
+        NUC_MATH_EXPORT(asin, 1),                                                                          \
+        NUC_MATH_EXPORT(asinh, 1),                                                                         \
+        NUC_MATH_EXPORT(atan, 1),                                                                          \
+        NUC_MATH_EXPORT(atanh, 1),                                                                         \
+        NUC_MATH_EXPORT(atan2, 2),                                                                         \
+        NUC_MATH_EXPORT(cbrt, 1),                                                                          \
+        NUC_MATH_EXPORT(ceil, 1),                                                                          \
+        NUC_MATH_EXPORT(clz32, 1),                                                                         \
+        NUC_MATH_EXPORT(cos, 1),                                                                           \
+        NUC_MATH_EXPORT(cosh, 1),                                                                          \
+        NUC_MATH_EXPORT(exp, 1),                                                                           \
+        NUC_MATH_EXPORT(expm1, 1),                                                                         \
+        NUC_MATH_EXPORT(floor, 1),                                                                         \
+        {"math.hypot", nuc_math__hypot, {.num2 = nuc_math__hypot2__fast, .num3 = nuc_math__hypot3__fast}}, \
+        NUC_MATH_EXPORT(imul, 2),                                                                          \
+        NUC_MATH_EXPORT(log, 1),                                                                           \
+        NUC_MATH_EXPORT(log1p, 1),                                                                         \
+        NUC_MATH_EXPORT(log10, 1),                                                                         \
+        NUC_MATH_EXPORT(log2, 1),                                                                          \
+        NUC_MATH_EXPORT(pow, 2),                                                                           \
+        NUC_MATH_EXPORT(round, 1),                                                                         \
+        NUC_MATH_EXPORT(roundf, 1),                                                                        \
+        NUC_MATH_EXPORT(signum, 1),                                                                        \
+        NUC_MATH_EXPORT(sin, 1),                                                                           \
+        NUC_MATH_EXPORT(sinh, 1),                                                                          \
+        NUC_MATH_EXPORT(sqrt, 1),                                                                          \
+        NUC_MATH_EXPORT(tan, 1),                                                                           \
+        NUC_MATH_EXPORT(tanh, 1),                                                                          \
+        NUC_MATH_EXPORT(trunc, 1)
 
     /***************
      *  UNDEFINES  *
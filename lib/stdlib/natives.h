@@ -17,14 +17,14 @@
 // this is removing more specialized "math" natives.
 
 #define NUC_NTVDEF_TIME
+#define NUC_NTVDEF_GC
 #define NUC_NTVDEF_MATH
 
 #define NUC_NTVDEF_DISRUPTIONS
 #define NUC_NTVDEF_THROW_DISRUPTION
 
 // defines for available reference array sizes
-#define NUC_NATIVE_REACTIONS_LEN 34  // THESE MUST BE CORRECT
-#define NUC_NATIVE_PROPS_LEN 0       // VALUES OR ELSE ITEMS MAY BE MISSED
+#define NUC_NATIVE_PROPS_LEN 0  // THIS MUST BE CORRECT OR ELSE ITEMS MAY BE MISSED
 
 /**********************
  *  TYPE DEFINITIONS  *
@@ -34,13 +34,23 @@
 typedef struct {
     const char* name;
     nuc_NativeReaction native;
+    nuc_NativeFastCall fast;  // typed entry points (left NULL for untyped natives)
 } nuc_NativeReactionReference;
 
+/**
+ * Exports an untyped native (which has no typed entry points).
+ * @param NAME              Name of the native.
+ * @param NATIVE            Native reaction.
+ */
+#define NUC_NATIVE_EXPORT(NAME, NATIVE) \
+    { NAME, NATIVE, {NULL, NULL, NULL} }
+
 /*********************
  *  LIBRARY HEADERS  *
  *********************/
 
 #include "disruption/throw.h"
+#include "gc/gc.h"
 #include "math/constants.h"
 #include "math/methods.h"
 #include "print.h"
@@ -52,12 +62,16 @@ typedef struct {
 
 nuc_NativeReactionReference nuc_nativeReactionRefs[] = {
     // miscellaneous
-    {"std.print", nuc_std__print},
+    NUC_NATIVE_EXPORT("std.print", nuc_std__print),
 
 #ifdef NUC_NTVDEF_TIME  // time natives
     NUC_STDLIB__TIME_NATIVES,
 #endif
 
+#ifdef NUC_NTVDEF_GC  // garbage collection natives
+    NUC_STDLIB__GC_NATIVES,
+#endif
+
 #ifdef NUC_NTVDEF_MATH  // math natives
     NUC_STDLIB__MATH_NATIVES,
 #endif
@@ -69,4 +83,7 @@ nuc_NativeReactionReference nuc_nativeReactionRefs[] = {
 #endif
 };
 
+// total available native reactions (follows the native guards above)
+#define NUC_NATIVE_REACTIONS_LEN ((int)(sizeof(nuc_nativeReactionRefs) / sizeof(nuc_NativeReactionReference)))
+
 #endif
\ No newline at end of file
@@ -34,7 +34,7 @@ NUC_NATIVE_WRAPPER(
 
     // exports all the TIME methods
     #define NUC_STDLIB__TIME_NATIVES \
-        { "std.time.clock", nuc_time__clock }
+        NUC_NATIVE_EXPORT("std.time.clock", nuc_time__clock)
 
     /***************
      *  UNDEFINES  *
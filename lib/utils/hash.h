@@ -18,4 +18,18 @@ static uint32_t hash_generic(const char* key, int length) {
     return hash;
 }
 
+/**
+ * Coordinates a string hashing algorithm to get a 64-bit unsigned hash (for whole sources).
+ * @param key           String to hash.
+ * @param length        Length of string.
+ */
+static uint64_t hash_wide(const char* key, size_t length) {
+    uint64_t hash = 14695981039346656037u;
+    for (size_t i = 0; i < length; i++) {
+        hash ^= (uint8_t)key[i];
+        hash *= 1099511628211u;
+    }
+    return hash;
+}
+
 #endif
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "core/call.h"
 #include "core/core.h"
 #include "core/flags.h"
+#include "core/globals.h"
 #include "core/invoke.h"
 #include "core/model.h"
 #include "core/upvalue.h"
@@ -23,12 +24,33 @@
 void atomizer_init() {
     atomizer_resetStack();
 
+    // initialise garbage collection variables
+    atomizer.grayCount = 0;
+    atomizer.grayCapacity = 0;
+    atomizer.grayStack = NULL;
+    atomizer.bytesAlloc = 0;
+    atomizer.nextGC = 1024 * 1024;
+    atomizer.nurseryAlloc = 0;
+    atomizer.nurseryLimit = NUC_GC_NURSERY_SIZE;
+    atomizer.minorGC = false;
+    atomizer.rememberedCount = 0;
+    atomizer.rememberedCapacity = 0;
+    atomizer.remembered = NULL;
+    atomizer.gcPhase = GC_IDLE;
+    atomizer.sweepPage = NULL;
+    atomizer.sweepLink = NULL;
+    atomizer.sliceAlloc = 0;
+    atomizer.sliceWork = NUC_GC_SLICE_WORK;
+    atomizer.gcWorkers = NUC_GC_WORKERS;
+    atomizer.gcStats = (nuc_GCStats){0, 0, 0, 0, 0, 0};
+
     // init all globals
-    atomizer.objects = NULL;
     atomizer.openUVs = NULL;
     table_init(&atomizer.globals);
+    particleArr_init(&atomizer.globalSlots);
+    particleArr_init(&atomizer.globalNames);
     table_init(&atomizer.interns);
-    table_init(&atomizer.natives);
+    atomizer_initNatives();
     atomizer_initPrimatives(&atomizer.primatives);
 
     // create and intern the common strings
@@ -36,13 +58,6 @@ void atomizer_init() {
     atomizer.disruption = objString_copy("Disruption", 10);
     atomizer.modelLiteral = objString_copy("Model", 5);
 
-    // initialise garbage collection variables
-    atomizer.grayCount = 0;
-    atomizer.grayCapacity = 0;
-    atomizer.grayStack = NULL;
-    atomizer.bytesAlloc = 0;
-    atomizer.nextGC = 1024 * 1024;
-
     // initialise the atomizer flags
     NUC_RESET_AFLAGS;
     atomizer.exitCode = NUC_EXIT_SUCCESS;  // safe exit code
@@ -55,8 +70,10 @@ void atomizer_init() {
 void atomizer_free() {
     // free all global items and objects
     table_free(&atomizer.globals);
+    particleArr_free(&atomizer.globalSlots);
+    particleArr_free(&atomizer.globalNames);
     table_free(&atomizer.interns);
-    table_free(&atomizer.natives);
+    particleArr_free(&atomizer.natives);
     atomizer_freePrimatives(&atomizer.primatives);
 
     // free the common strings
@@ -64,20 +81,30 @@ void atomizer_free() {
     atomizer.disruption = NULL;
     atomizer.modelLiteral = NULL;
 
-    // and free the grayed stack from memory
+    // and free the grayed stack / compiled code from memory
     free(atomizer.grayStack);
+    free(atomizer.remembered);
+    fuser_freeSegments();
+    slab_freeAll();
 }
 
+#ifdef NUC_DEBUG_CACHES
 /**
- * Callable method that coordinates compiling and running
- * a Nucleus atomization.
- * @param source                    Nucleus source code.
+ * Displays the inline cache statistics of an object (if a reaction).
+ * @param object                    Object to display.
  */
-uint8_t nuc_atomize(const char* source) {
-    // initially compile the source code
-    nuc_ObjReaction* reaction = nuc_fuse(source);
-    if (reaction == NULL) return NUC_EXIT_SYNTAX;
+static void atomizer_printCaches(nuc_Obj* object) {
+    if (object->type != OBJ_REACTION) return;
+    nuc_ObjReaction* reaction = (nuc_ObjReaction*)object;
+    nuc_printCaches(&reaction->chunk, reaction->name != NULL ? reaction->name->chars : "<script>");
+}
+#endif
 
+/**
+ * Runs an already compiled Nucleus script reaction.
+ * @param reaction                  Compiled script.
+ */
+uint8_t nuc_atomizeReaction(nuc_ObjReaction* reaction) {
     // push the compiled script as a reaction global
     PUSH(NUC_OBJ(reaction));
     nuc_ObjClosure* closure = closure_new(reaction);
@@ -87,7 +114,26 @@ uint8_t nuc_atomize(const char* source) {
 
     // quatises the atomization process
     atomizer_quantise();
+
+#ifdef NUC_DEBUG_CACHES  // display the inline cache statistics of all live reactions
+    slab_forEachObject(atomizer_printCaches);
+#endif
+
     return atomizer.exitCode;
 }
 
+/**
+ * Callable method that coordinates compiling and running
+ * a Nucleus atomization.
+ * @param source                    Nucleus source code.
+ */
+uint8_t nuc_atomize(const char* source) {
+    // initially compile the source code
+    nuc_ObjReaction* reaction = nuc_fuse(source);
+    if (reaction == NULL) return NUC_EXIT_SYNTAX;
+
+    // and run the compiled script
+    return nuc_atomizeReaction(reaction);
+}
+
 #endif
\ No newline at end of file
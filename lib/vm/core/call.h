@@ -37,9 +37,60 @@ static bool atomizer_call(nuc_ObjClosure* closure, int argCount) {
     frame->closure = closure;
     frame->ip = closure->reaction->chunk.code;
     frame->slots = atomizer.top - argCount - 1;
+
+    // register frames own a fixed window of slots, so clear the unused registers
+    if (closure->reaction->tier == NUC_TIER_REGISTER) {
+        frame->rip = closure->reaction->regs.code;
+        nuc_Particle* end = frame->slots + closure->reaction->regs.frameSize;
+        while (atomizer.top < end) *atomizer.top++ = NUC_NULL;
+    }
     return true;
 }
 
+/**
+ * Calls a native reaction directly with the arguments at the top of the stack. The arguments are
+ * replaced by the result (or by the disruption raised by the native).
+ * @param native                Native reaction to call.
+ * @param argCount              Total arguments given for call.
+ */
+static inline bool atomizer_callNative(nuc_NativeReaction native, int argCount) {
+    nuc_Particle result = native(argCount, atomizer.top - argCount);
+    if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) result = POP();  // forward the disruption instead
+    atomizer.top -= argCount;
+    PUSH(result);
+    return !NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED);
+}
+
+/**
+ * Calls a typed native entry point in place on numeric arguments (the result replaces the first
+ * argument). Only a NaN-tag test per argument is required before calling the C method directly.
+ * @param fast                  Typed entry points of the native.
+ * @param argCount              Total arguments given for call.
+ * @param args                  Arguments of the call.
+ * @returns                     Whether the call could be completed (ie: all arguments numeric).
+ */
+static inline bool atomizer_callNativeFast(const nuc_NativeFastCall* fast, int argCount, nuc_Particle* args) {
+    switch (argCount) {
+        case 1:
+            if (!IS_NUMBER(args[0])) return false;
+            args[0] = NUC_NUM(fast->num1(AS_NUMBER(args[0])));
+            return true;
+
+        case 2:
+            if (!IS_NUMBER(args[0]) || !IS_NUMBER(args[1])) return false;
+            args[0] = NUC_NUM(fast->num2(AS_NUMBER(args[0]), AS_NUMBER(args[1])));
+            return true;
+
+        case 3:
+            if (!IS_NUMBER(args[0]) || !IS_NUMBER(args[1]) || !IS_NUMBER(args[2])) return false;
+            args[0] = NUC_NUM(fast->num3(AS_NUMBER(args[0]), AS_NUMBER(args[1]), AS_NUMBER(args[2])));
+            return true;
+
+        default:
+            return false;
+    }
+}
+
 /**
  * Calls a given particle value. If not a callable particle, then throws a runtime error.
  * @param callee                Particle that can be called.
@@ -50,17 +101,9 @@ static bool atomizer_callValue(nuc_Particle callee, int argCount) {
         // switch based on the given callee's object typing
         switch (OBJ_TYPE(callee)) {
             case OBJ_NATIVE: {  // want to call the item as a native method
-                nuc_NativeReaction native = AS_NATIVE(callee);
-                nuc_Particle result = native(argCount, atomizer.top - argCount);
-                if (!NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) {
-                    atomizer.top -= argCount + 1;
-                    PUSH(result);
-                } else {
-                    nuc_Particle disruption = POP();
-                    atomizer.top -= argCount + 1;
-                    PUSH(disruption);
-                }
-                return !NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED);
+                bool success = atomizer_callNative(AS_NATIVE(callee), argCount);
+                atomizer.top[-2] = POP();  // and the result replaces the callee
+                return success;
             }
 
             case OBJ_CLOSURE:  // can simple call as a closure
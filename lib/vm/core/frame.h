@@ -8,6 +8,7 @@
 typedef struct {
     nuc_ObjClosure* closure;  // pointer to associated closure reaction
     uint8_t* ip;              // frame instruction pointer
+    uint32_t* rip;            // frame register instruction pointer (register tier)
     nuc_Particle* slots;      // internal local slots
 } nuc_CallFrame;
 
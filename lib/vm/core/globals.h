@@ -0,0 +1,69 @@
+#ifndef NUC_ATOMIZER_GLOBAL_SLOTS_H
+#define NUC_ATOMIZER_GLOBAL_SLOTS_H
+
+// Nucleus Headers
+#include "../../particle/objects/type.h"
+#include "../../particle/table.h"
+#include "../../particle/value.h"
+#include "../global.h"
+#include "core.h"
+
+/****************************
+ *  GLOBAL SLOT RESOLUTION  *
+ ****************************/
+
+/**
+ * Retrieves the slot of a global variable, reserving an undefined slot the first time the name is
+ * seen. Slots are shared by every compiled chunk, so a global keeps its slot for the lifetime of
+ * the atomizer (including between REPL lines).
+ * @param name                          Name of the global.
+ * @returns                             Slot of the global, or -1 if all slots are taken.
+ */
+static int atomizer_globalSlot(nuc_ObjString* name) {
+    nuc_Particle slot;
+    if (table_get(&atomizer.globals, name, &slot)) return (int)AS_NUMBER(slot);
+    if (atomizer.globalSlots.count == UINT16_COUNT) return -1;
+
+    // reserve the slot (keeping the name reachable whilst the arrays grow)
+    int index = atomizer.globalSlots.count;
+    atomizer_push(NUC_OBJ(name));
+    particleArr_write(&atomizer.globalSlots, NUC_UNDEFINED);
+    particleArr_write(&atomizer.globalNames, NUC_OBJ(name));
+    table_set(&atomizer.globals, name, NUC_NUM(index));
+    atomizer_pop();
+    return index;
+}
+
+/**
+ * Defines a global variable by name.
+ * @param name                          Name of the global.
+ * @param value                         Value to define.
+ */
+static inline void atomizer_defineGlobal(nuc_ObjString* name, nuc_Particle value) {
+    atomizer_push(value);  // the value must stay reachable whilst a slot is reserved
+    int slot = atomizer_globalSlot(name);
+    atomizer.globalSlots.values[slot] = atomizer_pop();
+}
+
+/**
+ * Retrieves a defined global variable by name.
+ * @param name                          Name of the global.
+ * @param value                         Pointer to store the value to.
+ * @returns                             Whether the global has been defined.
+ */
+static inline bool atomizer_getGlobal(nuc_ObjString* name, nuc_Particle* value) {
+    nuc_Particle slot;
+    if (!table_get(&atomizer.globals, name, &slot)) return false;
+    *value = atomizer.globalSlots.values[(int)AS_NUMBER(slot)];
+    return !IS_UNDEFINED(*value);
+}
+
+/**
+ * Retrieves the name of a global slot (for error reporting).
+ * @param slot                          Global slot.
+ */
+static inline nuc_ObjString* atomizer_globalName(int slot) {
+    return AS_STRING(atomizer.globalNames.values[slot]);
+}
+
+#endif
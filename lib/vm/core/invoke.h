@@ -5,6 +5,7 @@
 #include "../../particle/objects/type.h"
 #include "../disruptions/disruption.h"
 #include "call.h"
+#include "model.h"
 
 /********************
  *  INVOKE METHODS  *
@@ -42,12 +43,9 @@ static bool atomizer_invoke(nuc_ObjString* name, int argCount) {
             nuc_ObjInstance* inst = AS_INSTANCE(receiver);
 
             nuc_Particle value;  // now want to find the called item
-            if (table_get(&inst->fields, name, &value)) {
+            if (model_getField(inst, name, &value)) {
                 atomizer.top[-argCount - 1] = value;  // got a valid field
                 return atomizer_callValue(value, argCount);
-            } else if (table_get(&inst->model->defaults, name, &value)) {
-                atomizer.top[-argCount - 1] = value;  // got a valid default field
-                return atomizer_callValue(value, argCount);
             }
 
             // otherwise try invoking a method call
@@ -70,4 +68,28 @@ static bool atomizer_invoke(nuc_ObjString* name, int argCount) {
     return false;
 }
 
+/**
+ * Invokes an instance method through an inline cache. Any other receivers (or undefined members)
+ * are handed to `atomizer_invoke` for the usual resolution / disruptions.
+ * @param name              Name of invokation method.
+ * @param argCount          Number of arguments given.
+ * @param cache             Inline cache of the invoking site.
+ */
+static inline bool atomizer_invokeCached(nuc_ObjString* name, int argCount, nuc_InlineCache* cache) {
+    nuc_Particle receiver = PEEK(argCount);
+    if (!IS_INSTANCE(receiver)) return atomizer_invoke(name, argCount);
+
+    // resolve the member through the cache
+    nuc_ObjInstance* inst = AS_INSTANCE(receiver);
+    uint8_t kind;
+    int index = atomizer_cachedMember(cache, inst, name, &kind);
+    if (index < 0) return atomizer_invoke(name, argCount);
+    if (kind == IC_METHOD) return atomizer_call(AS_CLOSURE(inst->model->methods.entries[index].value), argCount);
+
+    // otherwise calls the field
+    nuc_Particle value = inst->slots[index];
+    atomizer.top[-argCount - 1] = value;
+    return atomizer_callValue(value, argCount);
+}
+
 #endif
\ No newline at end of file
@@ -15,7 +15,7 @@
 static inline void atomizer_defineField(nuc_ObjString* name) {
     nuc_Particle field = PEEK(0);
     nuc_ObjModel* model = AS_MODEL(PEEK(1));
-    table_set(&model->defaults, name, field);
+    model_setDefault(model, name, field);
     POP();
 }
 
@@ -26,10 +26,104 @@ static inline void atomizer_defineField(nuc_ObjString* name) {
 static inline void atomizer_defineMethod(nuc_ObjString* name) {
     nuc_Particle method = PEEK(0);
     nuc_ObjModel* model = AS_MODEL(PEEK(1));
+    gc_writeBarrier((nuc_Obj*)model, method);
     table_set(&model->methods, name, method);
     POP();
 }
 
+/***************************
+ *  CACHED MEMBER LOOKUPS  *
+ ***************************/
+
+/**
+ * Remembers a resolved lookup in an inline cache of the running reaction. Caches keep the models
+ * of their shapes alive, so the reaction is written to like any other object.
+ * @param cache             Inline cache of the accessing site.
+ * @param entry             Resolved lookup.
+ */
+static inline void atomizer_cacheUpdate(nuc_InlineCache* cache, nuc_CacheEntry entry) {
+    gc_writeBarrier((nuc_Obj*)atomizer.frames[atomizer.frameCount - 1].closure->reaction, NUC_OBJ(entry.shape->model));
+    cache_update(cache, entry);
+}
+
+/**
+ * Looks up an instance member through an inline cache, falling back to the shape of the instance
+ * and then the model methods on a miss (and remembering the result). Instances of the same shape
+ * hold exactly the same fields, so a cached METHOD can never be shadowed by a field.
+ * @param cache             Inline cache of the accessing site.
+ * @param inst              Instance to look the member up in.
+ * @param name              Name of member.
+ * @param kind              Pointer to store the resolved kind to.
+ * @returns                 Slot offset / method entry index, or -1 if undefined.
+ */
+static inline int atomizer_cachedMember(nuc_InlineCache* cache, nuc_ObjInstance* inst, nuc_ObjString* name, uint8_t* kind) {
+    for (int i = 0; i < cache->count; i++) {
+        nuc_CacheEntry* entry = &cache->entries[i];
+        if (entry->shape != inst->shape || entry->kind == IC_TRANSITION) continue;
+
+        // fields are fixed by the shape, whereas methods confirm their entry still holds the name
+        nuc_Table* methods = &inst->model->methods;
+        if (entry->kind == IC_FIELD || (entry->index < methods->capacity && methods->entries[entry->index].key == name)) {
+            IC_HIT(cache);
+            *kind = entry->kind;
+            return entry->index;
+        }
+        break;  // stale entry, so resolve again
+    }
+
+    // otherwise resolve the member by hashing
+    IC_MISS(cache);
+    int index = shape_lookup(inst->shape, name);
+    if (index >= 0) {
+        *kind = IC_FIELD;
+    } else if ((index = table_indexOf(&inst->model->methods, name)) >= 0) {
+        *kind = IC_METHOD;
+    } else {
+        return -1;
+    }
+
+    atomizer_cacheUpdate(cache, (nuc_CacheEntry){inst->shape, NULL, index, *kind});
+    return index;
+}
+
+/**
+ * Sets an instance field through an inline cache. Sites that keep adding the same field to the
+ * same shape (such as constructors) remember the transition, so no hashing is required.
+ * @param cache             Inline cache of the setting site.
+ * @param inst              Instance to set field of.
+ * @param name              Name of field.
+ * @param value             Value of field (reachable by the collector).
+ */
+static inline void atomizer_cachedSetField(nuc_InlineCache* cache, nuc_ObjInstance* inst, nuc_ObjString* name, nuc_Particle value) {
+    gc_writeBarrier((nuc_Obj*)inst, value);
+    for (int i = 0; i < cache->count; i++) {
+        nuc_CacheEntry* entry = &cache->entries[i];
+        if (entry->shape != inst->shape || entry->kind == IC_METHOD) continue;
+
+        IC_HIT(cache);
+        if (entry->kind == IC_FIELD) {
+            inst->slots[entry->index] = value;
+        } else {
+            model_transitionField(inst, entry->target, value);
+        }
+        return;
+    }
+
+    // otherwise resolve the field by hashing
+    IC_MISS(cache);
+    nuc_Shape* shape = inst->shape;
+    int offset = shape_lookup(shape, name);
+    if (offset >= 0) {
+        inst->slots[offset] = value;
+        atomizer_cacheUpdate(cache, (nuc_CacheEntry){shape, NULL, offset, IC_FIELD});
+        return;
+    }
+
+    nuc_Shape* target = shape_transition(shape, name);
+    model_transitionField(inst, target, value);
+    atomizer_cacheUpdate(cache, (nuc_CacheEntry){shape, target, target->count - 1, IC_TRANSITION});
+}
+
 /**
  * Binds a method to global / local variable outside of the models scope.
  * @param model             Model of method.
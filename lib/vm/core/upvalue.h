@@ -38,6 +38,7 @@ static void nuc_upvalue_closeAll(nuc_Particle* last) {
     // while available to close
     while (atomizer.openUVs != NULL && atomizer.openUVs->location >= last) {
         nuc_ObjUpvalue* uv = atomizer.openUVs;
+        gc_writeBarrier((nuc_Obj*)uv, *uv->location);
         uv->closed = *uv->location;
         uv->location = &uv->closed;
         atomizer.openUVs = uv->next;
@@ -83,10 +83,10 @@ static void atomizer_runtimeError(uint8_t code, const char* format, ...) {
     for (int i = atomizer.frameCount - 1; i >= endFrame; i--) {
         nuc_CallFrame* frame = &atomizer.frames[i];
         nuc_ObjReaction* reaction = frame->closure->reaction;
-        size_t inst = frame->ip - reaction->chunk.code - 1;
-
         // retrieve some items for displaying the called line
-        size_t line = reaction->chunk.lines[inst];
+        size_t line = reaction->tier == NUC_TIER_REGISTER
+                          ? lineTable_get(&reaction->regs.lines, (int)(frame->rip - reaction->regs.code - 1))
+                          : lineTable_get(&reaction->chunk.lines, (int)(frame->ip - reaction->chunk.code - 1));
         const char* source = lexer_getLine(line);
 
         fprintf(stderr, "[\x1b[2mline\x1b[0m \x1b[33m%lu\x1b[0m] ", line);
@@ -148,15 +148,15 @@ static void atomizer_catchableError(uint8_t code, const char* format, ...) {
  */
 static void atomizer_thrownDisruption(nuc_ObjInstance* disruption) {
     // preemptively get the code (needed for BOTH)
-    nuc_Particle codeValue;
+    nuc_Particle codeValue = NUC_NULL;
     nuc_ObjString* codeAccessor = objString_copy("code", 4);
-    table_get(&disruption->fields, codeAccessor, &codeValue);
+    model_getField(disruption, codeAccessor, &codeValue);
 
     // if not in a catchable state
     if (!NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTION_CATCHABLE)) {
-        nuc_Particle msgValue;
+        nuc_Particle msgValue = NUC_NULL;
         nuc_ObjString* msgAccessor = objString_copy("message", 7);
-        table_get(&disruption->fields, msgAccessor, &msgValue);
+        model_getField(disruption, msgAccessor, &msgValue);
         atomizer_runtimeError((uint8_t)AS_NUMBER(codeValue), AS_CSTRING(msgValue));
         return;
     }
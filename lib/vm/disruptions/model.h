@@ -3,6 +3,7 @@
 
 // Nucleus Headers
 #include "../core/core.h"
+#include "../core/globals.h"
 #include "codes.h"
 
 /**
@@ -13,21 +14,24 @@
  */
 static inline void atomizer_buildDisruptionModel(const char* msg, size_t length, uint8_t code) {
     // retrieve the parent model
-    nuc_Particle base;
-    table_get(&atomizer.globals, atomizer.disruption, &base);
+    nuc_Particle base = NUC_NULL;
+    atomizer_getGlobal(atomizer.disruption, &base);
 
     // create the disruption instance
     nuc_Particle disruption = NUC_OBJ(model_newInstance(AS_MODEL(base)));
     PUSH(disruption);
     nuc_ObjInstance* instance = AS_INSTANCE(PEEK(0));
 
-    // now set the message string
-    nuc_ObjString* msgAccessor = objString_copy("message", 7);
-    table_set(&instance->fields, msgAccessor, NUC_OBJ(objString_copy(msg, length)));
+    // now set the message string (keeping both strings reachable whilst the shape transitions)
+    PUSH(NUC_OBJ(objString_copy("message", 7)));
+    PUSH(NUC_OBJ(objString_copy(msg, length)));
+    model_setField(instance, AS_STRING(PEEK(1)), PEEK(0));
+    POP_DOUBLE();
 
     // and after that the exit code given
-    nuc_ObjString* codeAccessor = objString_copy("code", 4);
-    table_set(&instance->fields, codeAccessor, NUC_NUM(code));
+    PUSH(NUC_OBJ(objString_copy("code", 4)));
+    model_setField(instance, AS_STRING(PEEK(0)), NUC_NUM(code));
+    POP();
 }
 
 #endif
\ No newline at end of file
@@ -2,6 +2,9 @@
 #define NUC_GARBAGE_COLLECTION_H
 
 // C Standard Library
+#include <limits.h>
+#include <string.h>
+#include <time.h>
 #ifdef NUC_DEBUG_GC
     #include <stdio.h>
 #endif
@@ -9,12 +12,26 @@
 // Nucleus Headers
 #include "../../common.h"
 #include "../../compiler/core/mark.h"
+#include "../../particle/shape.h"
 #include "../../particle/table.h"
 #include "../../particle/value.h"
+#include "parallel.h"
+#include "slab.h"
 
 // garbage collection growth factor
 #define NUC_GC_HEAP_GROWTH_FACTOR 2
 
+// bytes allocated between minor collections of the nursery
+#define NUC_GC_NURSERY_SIZE (256 * 1024)
+
+// objects traced / swept by each slice of a major collection (unless configured otherwise)
+#ifndef NUC_GC_SLICE_WORK
+    #define NUC_GC_SLICE_WORK 4096
+#endif
+
+// bytes allocated between the slices of a major collection
+#define NUC_GC_SLICE_SIZE (32 * 1024)
+
 /****************
  *  GC MARKING  *
  ****************/
@@ -25,7 +42,13 @@
  */
 void gc_markObject(nuc_Obj* object) {
     if (object == NULL) return;
-    if (object->isMarked) return;
+    if (gc_worker != NULL) {  // (whilst marking in parallel)
+        gc_markShared(object);
+        return;
+    }
+
+    if (atomizer.minorGC && object->isOld) return;  // old objects survive minor collections
+    if (slab_isMarked(object)) return;
 
 #ifdef NUC_DEBUG_GC  // garbage collection log
     printf("[\x1b[2;31mGC\x1b[0m] ");
@@ -34,8 +57,9 @@ void gc_markObject(nuc_Obj* object) {
     printf("\n");
 #endif
 
-    // mark the object
-    object->isMarked = true;
+    // mark the object (survivors of any collection are old)
+    slab_setMarked(object, true);
+    object->isOld = true;
 
     // and now continue add to the grayed values
     if (atomizer.grayCapacity < atomizer.grayCount + 1) {
@@ -76,6 +100,16 @@ void gc_markTable(nuc_Table* table) {
     }
 }
 
+/**
+ * Marks a shape tree from garbage collection. Each shape only adds a single field name to its
+ * parent, so marking every transition name covers the slot tables of the whole tree.
+ * @param shape             Root of the shape tree.
+ */
+void gc_markShape(nuc_Shape* shape) {
+    gc_markObject((nuc_Obj*)shape->name);
+    for (int i = 0; i < shape->childCount; i++) gc_markShape(shape->children[i]);
+}
+
 /** Marks roots of all items NOT to be Garbage Collected. */
 static void gc_markRoots() {
     for (nuc_Particle* slot = atomizer.stack; slot < atomizer.top; slot++) gc_markValue(*slot);
@@ -86,6 +120,9 @@ static void gc_markRoots() {
 
     // now want to mark tables / roots of atomizer
     gc_markTable(&atomizer.globals);
+    gc_markArray(&atomizer.globalSlots);
+    gc_markArray(&atomizer.globalNames);
+    gc_markArray(&atomizer.natives);
     gc_markObject((nuc_Obj*)atomizer.constructor);
     gc_markObject((nuc_Obj*)atomizer.disruption);
     gc_markObject((nuc_Obj*)atomizer.modelLiteral);
@@ -115,6 +152,12 @@ static void gc_blackenObject(nuc_Obj* object) {
             nuc_ObjReaction* reaction = (nuc_ObjReaction*)object;
             gc_markObject((nuc_Obj*)reaction->name);
             gc_markArray(&reaction->chunk.constants);
+
+            // shapes remembered by inline caches are kept alive (so their addresses cannot be reused)
+            for (int i = 0; i < reaction->chunk.caches.count; i++) {
+                nuc_InlineCache* cache = &reaction->chunk.caches.sites[i];
+                for (int j = 0; j < cache->count; j++) gc_markObject(cache->entries[j].shape->model);
+            }
         } break;
         case OBJ_UPVALUE:
             gc_markValue(((nuc_ObjUpvalue*)object)->closed);
@@ -124,106 +167,390 @@ static void gc_blackenObject(nuc_Obj* object) {
             gc_markObject((nuc_Obj*)model->name);
             gc_markTable(&model->methods);
             gc_markTable(&model->defaults);
+            gc_markShape(model->root);
+            gc_markArray(&model->initialSlots);
         } break;
-        case OBJ_INSTANCE: {
+        case OBJ_INSTANCE: {  // the field names are marked through the model shapes
             nuc_ObjInstance* inst = (nuc_ObjInstance*)object;
             gc_markObject((nuc_Obj*)inst->model);
-            gc_markTable(&inst->fields);
+            for (int i = 0; i < inst->shape->count; i++) gc_markValue(inst->slots[i]);
         } break;
         case OBJ_BOUND_METHOD: {
             nuc_ObjBoundMethod* bound = (nuc_ObjBoundMethod*)object;
             gc_markValue(bound->receiver);
             gc_markObject((nuc_Obj*)bound->method);
         } break;
-        case OBJ_ARRAY:
-        case OBJ_NATIVE:  // these items are coordinated through interns / globals
-        case OBJ_STRING:  // so no need to worry
+        case OBJ_STRING: {  // only ropes reference other strings
+            nuc_ObjString* string = (nuc_ObjString*)object;
+            gc_markObject((nuc_Obj*)string->left);
+            gc_markObject((nuc_Obj*)string->right);
+        } break;
+        case OBJ_ARRAY:   // these items are coordinated through interns / globals
+        case OBJ_NATIVE:  // so no need to worry
             break;
     }
 }
 
-/** Traces the GC references to blacken. */
+/**
+ * Marks an object that may be written to without a write barrier (ie: reactions still being
+ * compiled). Old objects are blackened straight away during minor collections, as they may refer
+ * to young objects without being remembered, as are objects already marked by a major collection.
+ * @param object            Object to be marked.
+ */
+void gc_markMutable(nuc_Obj* object) {
+    if (object != NULL && ((object->isOld && atomizer.minorGC) || slab_isMarked(object))) {
+        gc_blackenObject(object);
+    } else {
+        gc_markObject(object);
+    }
+}
+
+/**
+ * Remembers an old object that may now reference young objects, so minor collections can trace
+ * the object as a root.
+ * @param object            Old object to remember.
+ */
+static void gc_remember(nuc_Obj* object) {
+    object->isRemembered = true;
+    if (atomizer.rememberedCapacity < atomizer.rememberedCount + 1) {
+        atomizer.rememberedCapacity = NUC_CAP_GROW_FAST(atomizer.rememberedCapacity);
+        atomizer.remembered = (nuc_Obj**)realloc(atomizer.remembered, sizeof(nuc_Obj*) * atomizer.rememberedCapacity);
+        if (atomizer.remembered == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not reallocate space for garbage collection.");  // bad memory reallocation
+    }
+
+    atomizer.remembered[atomizer.rememberedCount++] = object;
+}
+
+/**
+ * Shades an object written into a marked object whilst a major collection is marking. The object is
+ * grayed (or grayed again if it is the owner itself, so that it is traced again).
+ * @param owner             Object being written to.
+ * @param object            Object to shade.
+ */
+static void gc_shade(nuc_Obj* owner, nuc_Obj* object) {
+    if (!slab_isMarked(owner)) return;
+    if (owner == object) slab_setMarked(object, false);
+    gc_markObject(object);
+}
+
+/** Forgets every remembered object (once there are no young objects left to reference). */
+static void gc_forgetRemembered() {
+    for (int i = 0; i < atomizer.rememberedCount; i++) atomizer.remembered[i]->isRemembered = false;
+    atomizer.rememberedCount = 0;
+}
+
+/** Traces the GC references to blacken (across the marking workers for major collections). */
 static void gc_traceRefs() {
+    if (atomizer.gcWorkers > 1 && !atomizer.minorGC && atomizer.grayCount > 0) {
+        gc_traceParallel();
+        return;
+    }
+
     while (atomizer.grayCount > 0) {
         nuc_Obj* object = atomizer.grayStack[--atomizer.grayCount];
         gc_blackenObject(object);
     }
 }
 
+/** Determines if an object survives the running collection. */
+static inline bool gc_isLive(nuc_Obj* object) { return (object->isOld && atomizer.minorGC) || slab_isMarked(object); }
+
 /** Removes all white references that are weakly linked. */
 static void gc_tableRemoveWhite(nuc_Table* table) {
     for (int i = 0; i < table->capacity; i++) {
         nuc_Entry* entry = &table->entries[i];
-        if (entry->key != NULL && !entry->key->obj.isMarked) table_delete(table, entry->key);
+        if (entry->key != NULL && !gc_isLive(&entry->key->obj)) table_delete(table, entry->key);
     }
 }
 
-/** Sweeps up the leftovers for garbage collection. */
-static void gc_sweep() {
-    nuc_Obj* prev = NULL;
-    nuc_Obj* object = atomizer.objects;
+/**
+ * Sweeps the unmarked objects of a slab page, found a bitmap word at a time. Marks are cleared for
+ * the next collection.
+ * @param page              Page to sweep.
+ * @param youngOnly         If only young objects are swept (promoting the young survivors).
+ * @returns                 Objects of the page swept.
+ */
+static int gc_sweepPage(nuc_SlabPage* page, bool youngOnly) {
+    int swept = 0;
+    for (int word = 0; word < page->words; word++) {
+        uint64_t cells = youngOnly ? page->young[word] : page->live[word] & (word == page->words - 1 ? page->lastMask : ~(uint64_t)0);
+        swept += __builtin_popcountll(cells);
+
+        uint64_t dead = cells & ~page->marks[word];
+        for (; dead != 0; dead &= dead - 1) obj_free(slab_cellAt(page, word * 64 + __builtin_ctzll(dead)));
+        page->marks[word] = 0;
+        if (youngOnly) page->young[word] = 0;
+    }
 
-    // iterate over the singly linked list
-    while (object != NULL) {
-        if (object->isMarked) {        // move onto next item
-            object->isMarked = false;  // unmark for next time
-            prev = object;
-            object = object->next;
+    return swept;
+}
+
+/**
+ * Sweeps up to a budget of the slab pages yet to be swept by a major collection.
+ * @param budget            Objects to sweep.
+ * @returns                 If every page has been swept.
+ */
+static bool gc_sweepPages(int budget) {
+    nuc_SlabPage* page = atomizer.sweepPage;
+    while (page != NULL && budget > 0) {
+        budget -= gc_sweepPage(page, false) + 1;
+        page->epoch = slabs.epoch;
+        page = page->next;
+    }
+
+    atomizer.sweepPage = page;
+    return page == NULL;
+}
+
+/**
+ * Sweeps up to a budget of the old large objects.
+ * @param budget            Objects to sweep.
+ * @returns                 If the end of the list was reached.
+ */
+static bool gc_sweepLarge(int budget) {
+    nuc_LargeObj** link = atomizer.sweepLink;
+    while (*link != NULL && budget-- > 0) {
+        nuc_LargeObj* large = *link;
+        if (large->isMarked) {        // move onto next item
+            large->isMarked = false;  // unmark for next time
+            link = &large->next;
         } else {  // found an unreachable item
-            nuc_Obj* unreached = object;
-            object = object->next;
-            if (prev != NULL) {
-                prev->next = object;
-            } else {
-                atomizer.objects = object;
-            }
+            *link = large->next;
+            obj_free((nuc_Obj*)(large + 1));
+        }
+    }
+
+    atomizer.sweepLink = link;
+    return *link == NULL;
+}
 
-            // and free the unreached object
-            obj_free(unreached);
+/**
+ * Sweeps up the leftovers of the nursery, promoting the survivors to the old generation. Only the
+ * pages allocated into since the last collection are swept.
+ */
+static void gc_sweepNursery() {
+    for (nuc_SlabPage* page = slabs.young; page != NULL; page = page->nextYoung) {
+        gc_sweepPage(page, true);
+        page->inYoung = false;
+    }
+
+    slabs.young = NULL;
+
+    // and the large objects (prepending the survivors to the old large objects)
+    nuc_LargeObj* large = slabs.largeYoung;
+    while (large != NULL) {
+        nuc_LargeObj* next = large->next;
+        if (large->isMarked) {        // promote the survivor
+            large->isMarked = false;  // unmark for next time
+            large->next = slabs.largeOld;
+            slabs.largeOld = large;
+        } else {  // found an unreachable item
+            obj_free((nuc_Obj*)(large + 1));
         }
+
+        large = next;
     }
+
+    slabs.largeYoung = NULL;
+    atomizer.nurseryAlloc = 0;
+}
+
+/**
+ * Ends the nursery at the completion of the marking of a major collection, as every young object is
+ * now either marked (so old) or garbage left to the sweep.
+ */
+static void gc_detachNursery() {
+    for (nuc_SlabPage* page = slabs.young; page != NULL; page = page->nextYoung) {
+        memset(page->young, 0, sizeof(uint64_t) * page->words);
+        page->inYoung = false;
+    }
+
+    slabs.young = NULL;
+
+    // the young large objects are swept with the old
+    while (slabs.largeYoung != NULL) {
+        nuc_LargeObj* large = slabs.largeYoung;
+        slabs.largeYoung = large->next;
+        large->next = slabs.largeOld;
+        slabs.largeOld = large;
+    }
+
+    atomizer.nurseryAlloc = 0;
+}
+
+/** Gets the wall time (in microseconds), as marking may run across several threads. */
+static double gc_clock() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1000000.0 + (double)now.tv_nsec / 1000.0;
+}
+
+/**
+ * Records the pause of a collection.
+ * @param start             Clock the collection started at.
+ */
+static void gc_recordPause(double start) {
+    double pause = gc_clock() - start;
+    atomizer.gcStats.pauseTotal += pause;
+    if (pause > atomizer.gcStats.pauseMax) atomizer.gcStats.pauseMax = pause;
 }
 
 /*****************
  *  GC MAIN API  *
  *****************/
 
-/** Collects Garbage :) */
-void gc_collect() {
+/**
+ * Collects the garbage of the nursery only. Old objects are assumed to be live, with the remembered
+ * objects traced as extra roots.
+ */
+void gc_collectMinor() {
+    double start = gc_clock();
+    atomizer.minorGC = true;
+
+    gc_markRoots();
+    for (int i = 0; i < atomizer.rememberedCount; i++) gc_blackenObject(atomizer.remembered[i]);
+    gc_traceRefs();
+    gc_tableRemoveWhite(&atomizer.interns);
+    gc_sweepNursery();
+    gc_forgetRemembered();  // as every survivor is now old
+
+    atomizer.minorGC = false;
+    atomizer.gcStats.minor++;
+    gc_recordPause(start);
+}
+
+/**
+ * Starts an incremental major collection by graying the roots. Objects allocated whilst marking
+ * start white, and are reached by rescanning the roots once the gray stack runs dry.
+ */
+static void gc_startMajor() {
 #ifdef NUC_DEBUG_LOG_GC
     printf("\x1b[2m[\x1b[0m\x1b[31mGC\x1b[0m\x1b[2m[\x1b[0m");
     printf(" Started\n");
-
-    // grab the before size
-    size_t before = atomizer.bytesAllocated;
 #endif
 
+    atomizer.gcPhase = GC_MARK;
+    atomizer.sliceAlloc = 0;
+    gc_marking = true;
+    gc_markRoots();
+}
+
+/**
+ * Completes the marking of a major collection. The roots are rescanned (as they are written to
+ * without barriers), then every page allocated until now is left to be swept (with objects
+ * allocated into these pages marked until then).
+ */
+static void gc_finishMark() {
     gc_markRoots();
     gc_traceRefs();
     gc_tableRemoveWhite(&atomizer.interns);
-    gc_sweep();
+    gc_forgetRemembered();  // before any remembered objects are swept
+    gc_detachNursery();
+    gc_marking = false;
+
+    slabs.epoch++;
+    slabs.sweeping = true;
+    atomizer.sweepPage = slabs.pages;
+    atomizer.gcPhase = GC_SWEEP_PAGES;
+}
+
+/** Completes a major collection. */
+static void gc_finishMajor() {
+    atomizer.sweepLink = NULL;
+    atomizer.gcPhase = GC_IDLE;
 
-    // and update the GC frequency
-    atomizer.nextGC = atomizer.bytesAlloc * NUC_GC_HEAP_GROWTH_FACTOR;
+    // and update the GC frequency (from the size of the old generation)
+    size_t oldAlloc = atomizer.bytesAlloc > atomizer.nurseryAlloc ? atomizer.bytesAlloc - atomizer.nurseryAlloc : 0;
+    atomizer.nextGC = oldAlloc * NUC_GC_HEAP_GROWTH_FACTOR;
+    atomizer.gcStats.major++;
 
 #ifdef NUC_DEBUG_LOG_GC
     printf("\x1b[2m[\x1b[0m\x1b[31mGC\x1b[0m\x1b[2m[\x1b[0m");
-    printf(" Ended\n");
-    printf("\x1b[2m[\x1b[0m\x1b[31mGC\x1b[0m\x1b[2m[\x1b[0m");
-    printf(" Collected \x1b[33m%zu\x1b[0m bytes (from \x1b[33m%zu\x1b[0m to \x1b[33m%zu\x1b[0m), next GC @ \x1b[33m%zu\x1b[0m bytes.\n",
-           before - atomizer.bytesAllocated,
-           before, atomizer.bytesAllocated,
-           atomizer.nextGC);
+    printf(" Ended, next GC @ \x1b[33m%zu\x1b[0m bytes.\n", atomizer.nextGC);
 #endif
 }
 
+/**
+ * Runs the running major collection onwards by a budget of work (objects traced / swept).
+ * @param budget            Work allowed, or -1 to run the collection to completion.
+ */
+static void gc_stepMajor(int budget) {
+    if (atomizer.gcPhase == GC_MARK) {
+        double start = gc_clock();
+        if (budget < 0) {
+            gc_traceRefs();
+        } else {
+            for (; atomizer.grayCount > 0 && budget > 0; budget--) gc_blackenObject(atomizer.grayStack[--atomizer.grayCount]);
+        }
+
+        if (atomizer.grayCount == 0) gc_finishMark();
+        atomizer.gcStats.markTotal += gc_clock() - start;
+        if (atomizer.gcPhase == GC_MARK) return;
+    }
+
+    if (atomizer.gcPhase == GC_SWEEP_PAGES) {
+        if (!gc_sweepPages(budget < 0 ? INT_MAX : budget)) return;
+        slabs.sweeping = false;
+        atomizer.sweepLink = &slabs.largeOld;
+        atomizer.gcPhase = GC_SWEEP_LARGE;
+    }
+
+    if (atomizer.gcPhase == GC_SWEEP_LARGE) {
+        if (!gc_sweepLarge(budget < 0 ? INT_MAX : budget)) return;
+        gc_finishMajor();
+    }
+}
+
+/** Runs a single slice of the running major collection. */
+static void gc_slice() {
+    double start = gc_clock();
+    atomizer.sliceAlloc = 0;
+    gc_stepMajor(atomizer.sliceWork);
+    atomizer.gcStats.slices++;
+    gc_recordPause(start);
+}
+
+/** Collects Garbage :) (running a whole major collection at once) */
+void gc_collect() {
+    double start = gc_clock();
+    if (atomizer.gcPhase == GC_IDLE) gc_startMajor();
+    gc_stepMajor(-1);
+    gc_recordPause(start);
+}
+
+/** Completes the running major collection (if any), so no collection is in progress. */
+void gc_finishCollection() {
+    if (atomizer.gcPhase != GC_IDLE) gc_collect();
+}
+
+/** Accounts a change of allocated bytes to the atomizer. */
+static inline void atomizer_account(size_t old_, size_t new_) { atomizer.bytesAlloc += new_ - old_; }
+
 /** Coordinates actually RUNNING a gc. */
 static void atomizer_gc(size_t old_, size_t new_) {
-    atomizer.bytesAlloc += new_ - old_;
+    atomizer_account(old_, new_);
+
+    // want to coordinate some garbage collection if desired (only when growing, as frees occur
+    // whilst sweeping and must not start another collection)
+    if (new_ <= old_) return;
+    atomizer.nurseryAlloc += new_ - old_;
+
+    // a running major collection is moved on by a slice for every so many bytes allocated
+    if (atomizer.gcPhase != GC_IDLE) {
+        atomizer.sliceAlloc += new_ - old_;
+        if (atomizer.sliceAlloc > NUC_GC_SLICE_SIZE) gc_slice();
+        return;
+    }
 
-    // want to coordinate some garbage collection if desired
-    if (atomizer.bytesAlloc > atomizer.nextGC) {
-        gc_collect();
+    // the old generation only grows by promotion, so is checked once the nursery is full
+    if (atomizer.nurseryAlloc <= atomizer.nurseryLimit) return;
+    size_t oldAlloc = atomizer.bytesAlloc > atomizer.nurseryAlloc ? atomizer.bytesAlloc - atomizer.nurseryAlloc : 0;
+    if (oldAlloc > atomizer.nextGC) {
+        double start = gc_clock();
+        gc_startMajor();
+        gc_recordPause(start);
+    } else {
+        gc_collectMinor();
     }
 }
 
@@ -0,0 +1,317 @@
+#ifndef NUC_GARBAGE_PARALLEL_H
+#define NUC_GARBAGE_PARALLEL_H
+
+// C Standard Library
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+// Nucleus Headers
+#include "../../common.h"
+#include "../../particle/objects/type.h"
+#include "../disruptions/codes.h"
+#include "../disruptions/immediate.h"
+#include "../global.h"
+#include "slab.h"
+
+// most worker threads marking in parallel
+#define NUC_GC_MAX_WORKERS 64
+
+// worker threads marking in parallel (unless configured otherwise)
+#ifndef NUC_GC_WORKERS
+    #define NUC_GC_WORKERS 1
+#endif
+
+// gray objects held by each worker deque (a power of two)
+#define NUC_GC_DEQUE_SIZE 8192
+
+// gray objects taken from the overflow at once
+#define NUC_GC_OVERFLOW_BATCH 64
+
+/**
+ * Work-Stealing Deque (of gray objects). The owning worker pushes and takes from the bottom, whilst
+ * idle workers steal from the top. Objects that do not fit are pushed to the shared overflow.
+ */
+typedef struct {
+    int64_t top;                        // next object to steal
+    int64_t bottom;                     // next free slot of the owner
+    nuc_Obj* items[NUC_GC_DEQUE_SIZE];  // circular buffer of objects
+} nuc_GCDeque;
+
+/** Marking Worker. */
+typedef struct {
+    nuc_GCDeque deque;  // gray objects of the worker
+    pthread_t thread;   // thread of the worker (unused for the main thread)
+    int index;          // index of the worker (the main thread being zero)
+    unsigned round;     // marks seen by the worker
+} nuc_GCWorker;
+
+/**
+ * Pool of marking workers. Threads are spawned on demand and then kept waiting for the next mark.
+ * Whilst marking in parallel, the gray stack of the atomizer is the overflow shared by the workers.
+ */
+typedef struct {
+    nuc_GCWorker* workers;  // every worker (allocated on demand)
+    int spawned;            // workers with a running thread
+    int active;             // workers of the running mark
+    int idle;               // active workers that are out of work
+    int finished;           // worker threads done with the running mark
+    unsigned round;         // marks started (so waiting threads know to wake)
+    pthread_mutex_t lock;   // guards the overflow / round
+    pthread_cond_t wake;    // signalled on starting a mark
+    pthread_cond_t done;    // signalled as the worker threads finish
+} nuc_GCPool;
+
+// the global worker pool
+nuc_GCPool gcPool = {NULL, 1, 0, 0, 0, 0, PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER};
+
+// worker of the current thread (whilst marking in parallel)
+static NUC_THREAD_LOCAL nuc_GCWorker* gc_worker = NULL;
+
+// forward declaration of blackening
+static void gc_blackenObject(nuc_Obj* object);
+
+/*************************
+ *  WORK-STEALING DEQUE  *
+ *************************/
+
+/**
+ * Pushes a gray object onto the bottom of a deque (by its owner).
+ * @param deque             Deque to push onto.
+ * @param object            Object to push.
+ * @returns                 If the deque had room for the object.
+ */
+static inline bool gc_dequePush(nuc_GCDeque* deque, nuc_Obj* object) {
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED);
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    if (bottom - top >= NUC_GC_DEQUE_SIZE) return false;
+
+    __atomic_store_n(&deque->items[bottom & (NUC_GC_DEQUE_SIZE - 1)], object, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+    return true;
+}
+
+/**
+ * Takes a gray object from the bottom of a deque (by its owner).
+ * @param deque             Deque to take from.
+ * @returns                 Object taken (or NULL if empty).
+ */
+static inline nuc_Obj* gc_dequeTake(nuc_GCDeque* deque) {
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_RELAXED) - 1;
+    __atomic_store_n(&deque->bottom, bottom, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_RELAXED);
+
+    // already empty
+    if (top > bottom) {
+        __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+        return NULL;
+    }
+
+    // the last object is raced for against any thieves
+    nuc_Obj* object = __atomic_load_n(&deque->items[bottom & (NUC_GC_DEQUE_SIZE - 1)], __ATOMIC_RELAXED);
+    if (top == bottom) {
+        if (!__atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) object = NULL;
+        __atomic_store_n(&deque->bottom, bottom + 1, __ATOMIC_RELAXED);
+    }
+
+    return object;
+}
+
+/**
+ * Steals a gray object from the top of a deque (by any other worker).
+ * @param deque             Deque to steal from.
+ * @returns                 Object stolen (or NULL if empty / lost to another thief).
+ */
+static inline nuc_Obj* gc_dequeSteal(nuc_GCDeque* deque) {
+    int64_t top = __atomic_load_n(&deque->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int64_t bottom = __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE);
+    if (top >= bottom) return NULL;
+
+    nuc_Obj* object = __atomic_load_n(&deque->items[top & (NUC_GC_DEQUE_SIZE - 1)], __ATOMIC_RELAXED);
+    if (!__atomic_compare_exchange_n(&deque->top, &top, top + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) return NULL;
+    return object;
+}
+
+/**********************
+ *  PARALLEL MARKING  *
+ **********************/
+
+/**
+ * Pushes a gray object to the shared overflow.
+ * @param object            Object to push.
+ */
+static void gc_pushOverflow(nuc_Obj* object) {
+    pthread_mutex_lock(&gcPool.lock);
+    if (atomizer.grayCapacity < atomizer.grayCount + 1) {
+        atomizer.grayCapacity = NUC_CAP_GROW_FAST(atomizer.grayCapacity);
+        atomizer.grayStack = (nuc_Obj**)realloc(atomizer.grayStack, sizeof(nuc_Obj*) * atomizer.grayCapacity);
+        if (atomizer.grayStack == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not reallocate space for garbage collection.");  // bad memory reallocation
+    }
+
+    atomizer.grayStack[atomizer.grayCount] = object;
+    __atomic_store_n(&atomizer.grayCount, atomizer.grayCount + 1, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&gcPool.lock);
+}
+
+/**
+ * Takes a batch of gray objects from the shared overflow, keeping all but one in the deque of a
+ * worker (which is empty).
+ * @param worker            Worker taking the objects.
+ * @returns                 Object to blacken (or NULL if the overflow is empty).
+ */
+static nuc_Obj* gc_takeOverflow(nuc_GCWorker* worker) {
+    if (__atomic_load_n(&atomizer.grayCount, __ATOMIC_ACQUIRE) == 0) return NULL;
+
+    pthread_mutex_lock(&gcPool.lock);
+    nuc_Obj* object = NULL;
+    if (atomizer.grayCount > 0) {
+        int count = atomizer.grayCount < NUC_GC_OVERFLOW_BATCH ? atomizer.grayCount : NUC_GC_OVERFLOW_BATCH;
+        int first = atomizer.grayCount - count;
+        object = atomizer.grayStack[first];
+        for (int i = first + 1; i < atomizer.grayCount; i++) gc_dequePush(&worker->deque, atomizer.grayStack[i]);
+        __atomic_store_n(&atomizer.grayCount, first, __ATOMIC_RELEASE);
+    }
+
+    pthread_mutex_unlock(&gcPool.lock);
+    return object;
+}
+
+/**
+ * Steals a gray object from any other active worker.
+ * @param worker            Worker stealing.
+ * @returns                 Object stolen (or NULL if none were found).
+ */
+static nuc_Obj* gc_stealWork(nuc_GCWorker* worker) {
+    for (int i = 1; i < gcPool.active; i++) {
+        nuc_Obj* object = gc_dequeSteal(&gcPool.workers[(worker->index + i) % gcPool.active].deque);
+        if (object != NULL) return object;
+    }
+
+    return NULL;
+}
+
+/** Determines if any gray objects remain for an idle worker to find. */
+static bool gc_workVisible() {
+    if (__atomic_load_n(&atomizer.grayCount, __ATOMIC_ACQUIRE) > 0) return true;
+    for (int i = 0; i < gcPool.active; i++) {
+        nuc_GCDeque* deque = &gcPool.workers[i].deque;
+        if (__atomic_load_n(&deque->top, __ATOMIC_ACQUIRE) < __atomic_load_n(&deque->bottom, __ATOMIC_ACQUIRE)) return true;
+    }
+
+    return false;
+}
+
+/**
+ * Marks an object whilst marking in parallel. Mark bits are set atomically, so only the worker to
+ * set the bit grays the object. Only major collections mark in parallel (so old objects are traced).
+ * @param object            Object to be marked.
+ */
+static void gc_markShared(nuc_Obj* object) {
+    if (!slab_tryMark(object)) return;
+    object->isOld = true;
+    if (!gc_dequePush(&gc_worker->deque, object)) gc_pushOverflow(object);
+}
+
+/**
+ * Blackens gray objects until every active worker runs out of work. Workers only go idle once their
+ * own deque is empty, and only busy workers push objects, so once every worker is idle no gray
+ * objects remain.
+ * @param worker            Worker marking.
+ */
+static void gc_markWorker(nuc_GCWorker* worker) {
+    for (;;) {
+        nuc_Obj* object = gc_dequeTake(&worker->deque);
+        if (object == NULL) object = gc_takeOverflow(worker);
+        if (object == NULL) object = gc_stealWork(worker);
+        if (object != NULL) {
+            gc_blackenObject(object);
+            continue;
+        }
+
+        // out of work, so wait for either more work or every other worker to be out of work
+        __atomic_add_fetch(&gcPool.idle, 1, __ATOMIC_SEQ_CST);
+        for (;;) {
+            if (__atomic_load_n(&gcPool.idle, __ATOMIC_SEQ_CST) == gcPool.active) return;
+            if (gc_workVisible()) break;
+            sched_yield();
+        }
+
+        __atomic_sub_fetch(&gcPool.idle, 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+/**
+ * Runs a worker thread, joining each mark it is active for.
+ * @param arg               Worker of the thread.
+ */
+static void* gc_workerMain(void* arg) {
+    nuc_GCWorker* worker = (nuc_GCWorker*)arg;
+    gc_worker = worker;
+
+    pthread_mutex_lock(&gcPool.lock);
+    for (;;) {
+        while (gcPool.round == worker->round) pthread_cond_wait(&gcPool.wake, &gcPool.lock);
+        worker->round = gcPool.round;
+        if (worker->index >= gcPool.active) continue;  // (not needed for this mark)
+
+        pthread_mutex_unlock(&gcPool.lock);
+        gc_markWorker(worker);
+        pthread_mutex_lock(&gcPool.lock);
+        if (++gcPool.finished == gcPool.active - 1) pthread_cond_signal(&gcPool.done);
+    }
+
+    return NULL;
+}
+
+/**
+ * Spawns worker threads until a count of workers are available.
+ * @param count             Workers required (including the main thread).
+ */
+static void gc_spawnWorkers(int count) {
+    if (gcPool.workers == NULL) {
+        gcPool.workers = (nuc_GCWorker*)calloc(NUC_GC_MAX_WORKERS, sizeof(nuc_GCWorker));
+        if (gcPool.workers == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not allocate the garbage collection workers.");
+    }
+
+    for (; gcPool.spawned < count; gcPool.spawned++) {
+        nuc_GCWorker* worker = &gcPool.workers[gcPool.spawned];
+        worker->index = gcPool.spawned;
+        worker->round = gcPool.round;  // (before the next mark wakes the workers)
+        if (pthread_create(&worker->thread, NULL, gc_workerMain, worker) != 0) break;  // (marking with the workers available)
+    }
+}
+
+/**
+ * Traces the gray stack across the marking workers, with the main thread marking as the first
+ * worker. Returns once every gray object has been blackened.
+ */
+static void gc_traceParallel() {
+    gc_spawnWorkers(atomizer.gcWorkers);
+    int active = atomizer.gcWorkers < gcPool.spawned ? atomizer.gcWorkers : gcPool.spawned;
+    for (int i = 0; i < active; i++) gcPool.workers[i].deque.top = gcPool.workers[i].deque.bottom = 0;
+
+    // wake the worker threads
+    pthread_mutex_lock(&gcPool.lock);
+    gcPool.active = active;
+    gcPool.idle = 0;
+    gcPool.finished = 0;
+    gcPool.round++;
+    pthread_cond_broadcast(&gcPool.wake);
+    pthread_mutex_unlock(&gcPool.lock);
+
+    // mark alongside them
+    gc_worker = &gcPool.workers[0];
+    gc_markWorker(gc_worker);
+    gc_worker = NULL;
+
+    // and wait for the others to stop looking for work
+    pthread_mutex_lock(&gcPool.lock);
+    while (gcPool.finished < active - 1) pthread_cond_wait(&gcPool.done, &gcPool.lock);
+    pthread_mutex_unlock(&gcPool.lock);
+}
+
+#endif
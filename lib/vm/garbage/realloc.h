@@ -12,6 +12,7 @@
 
 // FORWARD DECLARATION
 static void atomizer_gc(size_t prev, size_t now);
+static void atomizer_account(size_t prev, size_t now);
 
 /**
  * Reallocates a pointer with a new size.
@@ -34,4 +35,16 @@ void* nuc_realloc(void* ptr, size_t prev, size_t now) {
     return res;
 }
 
+/**
+ * Allocates memory accounted to the atomizer, WITHOUT possibly starting a collection (so objects
+ * do not need to be reachable whilst allocating). Freed as usual.
+ * @param size                  Size to allocate.
+ */
+void* nuc_allocQuiet(size_t size) {
+    atomizer_account(0, size);
+    void* res = malloc(size);
+    if (res == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not allocate memory.");
+    return res;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,355 @@
+#ifndef NUC_SLAB_H
+#define NUC_SLAB_H
+
+// C Standard Library
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Nucleus Headers
+#include "../../common.h"
+#include "../../particle/objects/type.h"
+#include "../disruptions/codes.h"
+#include "../disruptions/immediate.h"
+#include "realloc.h"
+
+/******************
+ *  SLAB DEFINES  *
+ ******************/
+
+#define NUC_SLAB_GRANULE 16                                           // cell sizes are multiples of the granule
+#define NUC_SLAB_CLASSES 16                                           // size classes (of 16 to 256 bytes)
+#define NUC_SLAB_MAX_CELL (NUC_SLAB_GRANULE * NUC_SLAB_CLASSES)        // largest object held in a slab
+#define NUC_SLAB_PAGE_SIZE (64 * 1024)                                // bytes of each slab page (and its alignment)
+#define NUC_SLAB_WORDS (NUC_SLAB_PAGE_SIZE / NUC_SLAB_GRANULE / 64)  // bitmap words covering the most cells of a page
+
+/**
+ * Gets the size class of an allocation.
+ * @param size              Size of the allocation (at most NUC_SLAB_MAX_CELL).
+ */
+#define NUC_SLAB_CLASS(size) ((int)(((size) + NUC_SLAB_GRANULE - 1) / NUC_SLAB_GRANULE) - 1)
+
+/**
+ * Gets the cell size of a size class.
+ * @param sizeClass         Size class of the cells.
+ */
+#define NUC_SLAB_CELL_SIZE(sizeClass) ((size_t)((sizeClass) + 1) * NUC_SLAB_GRANULE)
+
+/**
+ * Slab Page. Pages are carved into cells of a single size class, with the cells starting after the
+ * (granule aligned) page header. Objects carry no collection state of their own, instead the page
+ * holds a bit per cell in each of its side bitmaps (so sweeping only reads the bitmaps, and the
+ * cells of the objects being freed).
+ */
+typedef struct nuc_SlabPage {
+    struct nuc_SlabPage* next;       // next page of the slabs
+    struct nuc_SlabPage* nextFree;   // next page of the size class with free cells
+    struct nuc_SlabPage* nextYoung;  // next page holding young objects
+    uint32_t cellSize;               // bytes of each cell
+    uint32_t cellRecip;              // reciprocal of the cell size (for dividing by multiplying)
+    int sizeClass;                   // size class of the cells
+    int cellCount;                   // cells of the page
+    int words;                       // bitmap words covering the cells
+    int cursor;                      // bitmap word the search for a free cell resumes from
+    int epoch;                       // major collection the page was last swept by
+    bool listed;                     // if the page is allocated from (or waiting to be)
+    bool inYoung;                    // if the page is in the young pages
+    uint64_t lastMask;               // bits of the last bitmap word that are cells
+    uint64_t live[NUC_SLAB_WORDS];   // cells holding an object (bits past the cells are always set)
+    uint64_t marks[NUC_SLAB_WORDS];  // cells marked by the running collection
+    uint64_t young[NUC_SLAB_WORDS];  // cells allocated since the last minor collection
+} nuc_SlabPage;
+
+/** Large Object Header. Objects too large for the slabs are allocated after this header. */
+typedef struct nuc_LargeObj {
+    struct nuc_LargeObj* next;  // next large object of the generation
+    bool isMarked;              // if marked by the running collection
+} nuc_LargeObj;
+
+/** Size-class segregated slabs of small objects (and the list of large objects). */
+typedef struct {
+    nuc_SlabPage* current[NUC_SLAB_CLASSES];  // page each size class allocates from
+    nuc_SlabPage* free[NUC_SLAB_CLASSES];     // further pages of each size class with free cells
+    nuc_SlabPage* pages;                      // every page of the slabs (newest first)
+    nuc_SlabPage* young;                      // pages holding young objects
+    nuc_LargeObj* largeYoung;                 // large objects allocated since the last minor collection
+    nuc_LargeObj* largeOld;                   // large objects that have survived a collection
+    int epoch;                                // major collections that have finished marking
+    bool sweeping;                            // if pages of an older epoch are still to be swept
+} nuc_Slabs;
+
+// offset of the first cell of each page
+#define NUC_SLAB_HEADER ((sizeof(nuc_SlabPage) + NUC_SLAB_GRANULE - 1) & ~(size_t)(NUC_SLAB_GRANULE - 1))
+
+// the global slabs
+nuc_Slabs slabs = {{NULL}, {NULL}, NULL, NULL, NULL, NULL, 0, false};
+
+/**********************
+ *  SLAB CELL LOOKUP  *
+ **********************/
+
+/**
+ * Gets the page a small object lives in.
+ * @param obj               Object held in a slab.
+ */
+static inline nuc_SlabPage* slab_pageOf(nuc_Obj* obj) {
+    return (nuc_SlabPage*)((uintptr_t)obj & ~(uintptr_t)(NUC_SLAB_PAGE_SIZE - 1));
+}
+
+/**
+ * Gets the cell index of a small object within its page.
+ * @param page              Page of the object.
+ * @param obj               Object held in the page.
+ */
+static inline int slab_cellOf(nuc_SlabPage* page, nuc_Obj* obj) {
+    uint64_t offset = (uint64_t)((uint8_t*)obj - (uint8_t*)page - NUC_SLAB_HEADER);
+    return (int)((offset * page->cellRecip) >> 32);
+}
+
+/**
+ * Gets the cell of an index within a page.
+ * @param page              Page of the cell.
+ * @param cell              Index of the cell.
+ */
+static inline nuc_Obj* slab_cellAt(nuc_SlabPage* page, int cell) {
+    return (nuc_Obj*)((uint8_t*)page + NUC_SLAB_HEADER + (size_t)cell * page->cellSize);
+}
+
+/**
+ * Gets the header of a large object.
+ * @param obj               Large object.
+ */
+static inline nuc_LargeObj* slab_largeOf(nuc_Obj* obj) { return (nuc_LargeObj*)obj - 1; }
+
+/***************
+ *  MARK BITS  *
+ ***************/
+
+/**
+ * Checks if an object is marked by the running collection.
+ * @param obj               Object to check.
+ */
+static inline bool slab_isMarked(nuc_Obj* obj) {
+    if (obj->isLarge) return slab_largeOf(obj)->isMarked;
+    nuc_SlabPage* page = slab_pageOf(obj);
+    int cell = slab_cellOf(page, obj);
+    return (page->marks[cell >> 6] >> (cell & 63)) & 1;
+}
+
+/**
+ * Marks (or unmarks) an object for the running collection.
+ * @param obj               Object to mark.
+ * @param marked            If marked.
+ */
+static inline void slab_setMarked(nuc_Obj* obj, bool marked) {
+    if (obj->isLarge) {
+        slab_largeOf(obj)->isMarked = marked;
+        return;
+    }
+
+    nuc_SlabPage* page = slab_pageOf(obj);
+    int cell = slab_cellOf(page, obj);
+    uint64_t bit = (uint64_t)1 << (cell & 63);
+    if (marked) {
+        page->marks[cell >> 6] |= bit;
+    } else {
+        page->marks[cell >> 6] &= ~bit;
+    }
+}
+
+/**
+ * Marks an object atomically (for marking in parallel).
+ * @param obj               Object to mark.
+ * @returns                 If the object was not already marked.
+ */
+static inline bool slab_tryMark(nuc_Obj* obj) {
+    if (obj->isLarge) return !__atomic_exchange_n(&slab_largeOf(obj)->isMarked, true, __ATOMIC_RELAXED);
+    nuc_SlabPage* page = slab_pageOf(obj);
+    int cell = slab_cellOf(page, obj);
+    uint64_t bit = (uint64_t)1 << (cell & 63);
+    return !(__atomic_fetch_or(&page->marks[cell >> 6], bit, __ATOMIC_RELAXED) & bit);
+}
+
+/******************
+ *  SLAB METHODS  *
+ ******************/
+
+/**
+ * Gets a page with free cells for a size class, reusing a page freed into by sweeping before adding
+ * a new page.
+ * @param sizeClass         Size class to allocate from.
+ */
+static nuc_SlabPage* slab_nextPage(int sizeClass) {
+    nuc_SlabPage* page = slabs.free[sizeClass];
+    if (page != NULL) {
+        slabs.free[sizeClass] = page->nextFree;
+        page->cursor = 0;
+        return page;
+    }
+
+    page = (nuc_SlabPage*)aligned_alloc(NUC_SLAB_PAGE_SIZE, NUC_SLAB_PAGE_SIZE);
+    if (page == NULL) nuc_immediateExit(NUC_EXIT_MEM, "Could not allocate a slab page.");
+    memset(page, 0, sizeof(nuc_SlabPage));
+
+    size_t cellSize = NUC_SLAB_CELL_SIZE(sizeClass);
+    page->cellSize = (uint32_t)cellSize;
+    page->cellRecip = (uint32_t)((((uint64_t)1 << 32) + cellSize - 1) / cellSize);  // (exact for offsets within a page)
+    page->sizeClass = sizeClass;
+    page->cellCount = (int)((NUC_SLAB_PAGE_SIZE - NUC_SLAB_HEADER) / cellSize);
+    page->words = (page->cellCount + 63) / 64;
+    page->lastMask = (page->cellCount & 63) ? ((uint64_t)1 << (page->cellCount & 63)) - 1 : ~(uint64_t)0;
+    page->live[page->words - 1] = ~page->lastMask;  // (so the bits past the cells are never free)
+    page->epoch = slabs.epoch;
+    page->listed = true;
+
+    page->next = slabs.pages;
+    slabs.pages = page;
+    return page;
+}
+
+/**
+ * Takes a free cell of a page for a new young object. Whilst a major collection sweeps, objects
+ * allocated into pages yet to be swept are marked (so the sweep does not free them).
+ * @param page              Page of the cell.
+ * @param word              Bitmap word of the cell.
+ * @param bit               Bit of the cell within the word.
+ */
+static inline void* slab_take(nuc_SlabPage* page, int word, int bit) {
+    uint64_t mask = (uint64_t)1 << bit;
+    page->live[word] |= mask;
+    page->young[word] |= mask;
+    if (slabs.sweeping && page->epoch != slabs.epoch) page->marks[word] |= mask;
+
+    if (!page->inYoung) {
+        page->inYoung = true;
+        page->nextYoung = slabs.young;
+        slabs.young = page;
+    }
+
+    nuc_Obj* obj = slab_cellAt(page, word * 64 + bit);
+    obj->isLarge = false;
+    return obj;
+}
+
+/**
+ * Allocates a small object from the slabs. The cell is accounted (and may start a collection) like
+ * any other allocation, then found by scanning the live bitmap of the current page of the size class.
+ * @param size              Size of the object (at most NUC_SLAB_MAX_CELL).
+ */
+static inline void* slab_alloc(size_t size) {
+    int sizeClass = NUC_SLAB_CLASS(size);
+    atomizer_gc(0, NUC_SLAB_CELL_SIZE(sizeClass));
+
+    nuc_SlabPage* page = slabs.current[sizeClass];
+    for (;;) {
+        if (page != NULL) {
+            for (int word = page->cursor; word < page->words; word++) {
+                uint64_t free = ~page->live[word];
+                if (free == 0) continue;
+                page->cursor = word;
+                return slab_take(page, word, __builtin_ctzll(free));
+            }
+
+            // wrap around to the cells freed behind the cursor, before giving up on the page
+            if (page->cursor > 0) {
+                page->cursor = 0;
+                continue;
+            }
+
+            page->listed = false;  // (until a sweep frees some of its cells)
+        }
+
+        page = slabs.current[sizeClass] = slab_nextPage(sizeClass);
+    }
+}
+
+/**
+ * Frees a small object by clearing its cell in the bitmaps, listing the page to be allocated from
+ * again if it was full.
+ * @param obj               Object to free.
+ */
+static inline void slab_free(nuc_Obj* obj) {
+    nuc_SlabPage* page = slab_pageOf(obj);
+    atomizer_gc(page->cellSize, 0);
+
+    int cell = slab_cellOf(page, obj);
+    uint64_t mask = ~((uint64_t)1 << (cell & 63));
+    page->live[cell >> 6] &= mask;
+    page->young[cell >> 6] &= mask;
+    page->marks[cell >> 6] &= mask;
+
+    if (!page->listed) {
+        page->listed = true;
+        page->nextFree = slabs.free[page->sizeClass];
+        slabs.free[page->sizeClass] = page;
+    }
+}
+
+/**
+ * Calls a visitor for every object held by the slabs (and every large object).
+ * @param visit             Visitor to call.
+ */
+static inline void slab_forEachObject(void (*visit)(nuc_Obj*)) {
+    for (nuc_SlabPage* page = slabs.pages; page != NULL; page = page->next) {
+        for (int word = 0; word < page->words; word++) {
+            uint64_t bits = page->live[word] & (word == page->words - 1 ? page->lastMask : ~(uint64_t)0);
+            for (; bits != 0; bits &= bits - 1) visit(slab_cellAt(page, word * 64 + __builtin_ctzll(bits)));
+        }
+    }
+
+    nuc_LargeObj* generations[] = {slabs.largeYoung, slabs.largeOld};
+    for (int i = 0; i < 2; i++) {
+        for (nuc_LargeObj* large = generations[i]; large != NULL; large = large->next) visit((nuc_Obj*)(large + 1));
+    }
+}
+
+/** Frees every slab page (once no objects remain in use). */
+static void slab_freeAll() {
+    while (slabs.pages != NULL) {
+        nuc_SlabPage* next = slabs.pages->next;
+        free(slabs.pages);
+        slabs.pages = next;
+    }
+
+    for (int i = 0; i < NUC_SLAB_CLASSES; i++) slabs.current[i] = slabs.free[i] = NULL;
+    slabs.young = NULL;
+}
+
+/********************
+ *  OBJECT STORAGE  *
+ ********************/
+
+/**
+ * Allocates the storage of an object, from the slabs if small enough. Larger objects are allocated
+ * after a header, and start in the young large objects.
+ * @param size              Size of the object.
+ */
+static inline nuc_Obj* nuc_allocObject(size_t size) {
+#ifndef NUC_NO_SLABS
+    if (size <= NUC_SLAB_MAX_CELL) return (nuc_Obj*)slab_alloc(size);
+#endif
+    nuc_LargeObj* large = (nuc_LargeObj*)nuc_realloc(NULL, 0, sizeof(nuc_LargeObj) + size);
+    large->isMarked = false;
+    large->next = slabs.largeYoung;
+    slabs.largeYoung = large;
+
+    nuc_Obj* obj = (nuc_Obj*)(large + 1);
+    obj->isLarge = true;
+    return obj;
+}
+
+/**
+ * Frees the storage of an object. Large objects must already be unlinked from their generation.
+ * @param obj               Object to free.
+ * @param size              Size of the object (as allocated).
+ */
+static inline void nuc_freeObject(nuc_Obj* obj, size_t size) {
+    if (!obj->isLarge) {
+        slab_free(obj);
+        return;
+    }
+
+    nuc_realloc(slab_largeOf(obj), sizeof(nuc_LargeObj) + size, 0);
+}
+
+#endif
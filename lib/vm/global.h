@@ -6,6 +6,7 @@
 #include "../common.h"
 #include "../particle/particle.h"
 #include "../particle/table.h"
+#include "garbage/slab.h"
 #include "core/frame.h"
 #include "primatives.h"
 
@@ -13,6 +14,24 @@
  *  GLOBAL DECLARATIONS  *
  *************************/
 
+/** Garbage Collection Statistics */
+typedef struct {
+    size_t minor;       // minor collections (of the nursery)
+    size_t major;       // major collections (of every object)
+    size_t slices;      // slices of major collections
+    double pauseTotal;  // time spent collecting (us)
+    double pauseMax;    // longest pause (us)
+    double markTotal;   // time spent marking by major collections (us)
+} nuc_GCStats;
+
+/** Phases of an incremental major collection. */
+typedef enum {
+    GC_IDLE,           // no major collection running
+    GC_MARK,           // tracing the gray stack
+    GC_SWEEP_PAGES,    // sweeping the slab pages
+    GC_SWEEP_LARGE,    // sweeping the large objects
+} nuc_GCPhase;
+
 /** Atomizer Virtual Machine Structure */
 typedef struct {
     nuc_Chunk* chunk;  // current bytecode chunk
@@ -27,11 +46,12 @@ typedef struct {
     nuc_Particle* top;              // pointer to top of stack
 
     // global variables
-    nuc_Obj* objects;           // global objects list
-    nuc_Table globals;          // script globals
-    nuc_Table interns;          // global string interns
-    nuc_Table natives;          // native methods
-    nuc_Primatives primatives;  // primative particle methods
+    nuc_Table globals;            // script global names => global slot
+    nuc_ParticleArr globalSlots;  // script global values (indexed by slot)
+    nuc_ParticleArr globalNames;  // script global names (indexed by slot)
+    nuc_Table interns;            // global string interns
+    nuc_ParticleArr natives;      // boxed native methods (indexed by native)
+    nuc_Primatives primatives;    // primative particle methods
 
     // common strings
     nuc_ObjString* constructor;   // "@construct" string
@@ -44,6 +64,19 @@ typedef struct {
     nuc_Obj** grayStack;
     size_t bytesAlloc;  // bytes allocated on last GC
     size_t nextGC;      // next GC bytes size
+    size_t nurseryAlloc;       // bytes allocated since the last collection
+    size_t nurseryLimit;       // bytes allocated before a minor collection
+    bool minorGC;              // if the running collection only traces young objects
+    int rememberedCount;       // old objects that may reference young objects
+    int rememberedCapacity;
+    nuc_Obj** remembered;
+    nuc_GCPhase gcPhase;       // phase of the running major collection
+    nuc_SlabPage* sweepPage;   // next slab page to sweep
+    nuc_LargeObj** sweepLink;  // link to the next large object to sweep
+    size_t sliceAlloc;         // bytes allocated since the last slice
+    int sliceWork;             // objects traced / swept per slice
+    int gcWorkers;             // workers marking in parallel
+    nuc_GCStats gcStats;       // collection counts / pauses
 
     // atomizer flags
     uint32_t flags;
@@ -41,15 +41,14 @@ static inline bool quantise_getModelMember(nuc_Particle accessor, nuc_ObjInstanc
         return false;
     }
 
-    // can now simply get the accessor name
-    nuc_ObjString* name = AS_STRING(accessor);
+    // can now get the accessor name (interned, as fields are keyed by interns)
+    PUSH(NUC_OBJ(instance));
+    nuc_ObjString* name = objString_intern(AS_STRING(accessor));
+    POP();
     nuc_Particle value;  // item being accessed
 
     // and attempt to access
-    if (table_get(&instance->model->defaults, name, &value)) {
-        PUSH(value);
-        return true;
-    } else if (table_get(&instance->fields, name, &value)) {
+    if (model_getField(instance, name, &value)) {
         PUSH(value);
         return true;
     }
@@ -84,6 +83,7 @@ static inline bool quantise_setArrayMember(nuc_Particle value, nuc_Particle acce
         return false;
     }
 
+    gc_writeBarrier((nuc_Obj*)arr, value);
     arr->values[(int)accessor] = value;
     PUSH(NUC_OBJ(arr));
     return true;
@@ -101,14 +101,15 @@ static inline bool quantise_setModelMember(nuc_Particle value, nuc_Particle acce
         return false;
     }
 
-    // can now simply get the accessor name
-    nuc_ObjString* name = AS_STRING(accessor);
-    if (!table_set(&instance->model->defaults, name, value)) {
-        table_set(&instance->fields, name, value);
-    }
-
-    // and push the value back onto the stack
+    // keep everything reachable whilst the accessor is interned and the instance may transition shapes
     PUSH(NUC_OBJ(instance));
+    PUSH(accessor);
+    PUSH(value);
+    nuc_ObjString* name = objString_intern(AS_STRING(accessor));
+    PUSH(NUC_OBJ(name));
+    model_setField(instance, name, value);
+    POP_DOUBLE();
+    POP();  // and leave the instance on the stack
     return true;
 }
 
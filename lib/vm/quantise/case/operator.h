@@ -7,67 +7,86 @@
 #define NUC_REPEAT_NS false
 
 /**
- * Casts a CONCATENATION argument to desired `nuc_ObjString` format.
- * @param dest                  Destination of `nuc_ObjString`.
+ * Retrieves the chars of a CONCATENATION argument. Numerics are formatted into a local buffer
+ * rather than allocated as (interned) strings.
+ * @param dest                  Destination of the chars.
+ * @param destLen               Destination of the chars length.
+ * @param buffer                Buffer for formatting numerics.
  * @param argNum                Stack argument number.
  */
-#define NUC_CONCAT_CAST(dest, argNum)                                                             \
+#define NUC_CONCAT_CAST(dest, destLen, buffer, argNum)                                            \
     if (IS_NUMBER(PEEK(argNum))) {                                                                \
-        char buffer[NUC_CONCAT_BUFF_LEN];     /** buffer for result */                            \
         double num = AS_NUMBER(PEEK(argNum)); /** get value as double */                          \
                                                                                                   \
         /** convert to string as required */                                                      \
         if (ceil(num) == num) {                                                                   \
-            snprintf(buffer, NUC_CONCAT_BUFF_LEN, "%lld", (int64_t)num);                          \
+            destLen = snprintf(buffer, NUC_CONCAT_BUFF_LEN, "%lld", (int64_t)num);                \
         } else {                                                                                  \
-            snprintf(buffer, NUC_CONCAT_BUFF_LEN, "%lf", num);                                    \
+            destLen = snprintf(buffer, NUC_CONCAT_BUFF_LEN, "%lf", num);                          \
         }                                                                                         \
                                                                                                   \
-        /** save copy to destination */                                                           \
-        dest = objString_copy(buffer, (int)strlen(buffer));                                       \
+        /** clamp truncated numerics */                                                           \
+        if (destLen >= NUC_CONCAT_BUFF_LEN) destLen = NUC_CONCAT_BUFF_LEN - 1;                    \
+        dest = buffer;                                                                            \
     } else if (IS_STRING(PEEK(argNum))) {                                                         \
-        dest = AS_STRING(PEEK(argNum));                                                           \
+        dest = AS_STRING(PEEK(argNum))->chars;                                                    \
+        destLen = AS_STRING(PEEK(argNum))->length;                                                \
     } else { /** Otherwise results in a type error */                                             \
         atomizer_catchableError(NUC_EXIT_TYPE, "Only strings and numerics can be concatenated."); \
         return false;                                                                             \
     }
 
-/** Concatenates two strings, or a string and number together. */
-static inline bool quantise_concat() {
-    nuc_ObjString* b;
-    nuc_ObjString* a;  // set placeholders
+/**
+ * Retrieves a CONCATENATION argument as a string for a rope, replacing numerics on the stack with
+ * their (uninterned) string so they stay reachable.
+ * @param chars                 Chars of the argument.
+ * @param length                Length of the chars.
+ * @param argNum                Stack argument number.
+ */
+static inline nuc_ObjString* quantise_concatString(const char* chars, int length, int argNum) {
+    if (IS_STRING(PEEK(argNum))) return AS_STRING(PEEK(argNum));
+    nuc_ObjString* string = objString_copyLazy(chars, length);
+    atomizer.top[-1 - argNum] = NUC_OBJ(string);
+    return string;
+}
 
-    // allocate the above strings
-    NUC_CONCAT_CAST(b, 0);
-    NUC_CONCAT_CAST(a, 1);
+/**
+ * Concatenates two strings, or a string and number together. The result is not interned, as
+ * strings built in a loop would otherwise be hashed (and interned) at every step, and long
+ * results are built as ropes so that appending does not copy the whole string each time.
+ */
+static inline bool quantise_concat() {
+    char bufferA[NUC_CONCAT_BUFF_LEN], bufferB[NUC_CONCAT_BUFF_LEN];
+    const char* a;
+    const char* b;  // set placeholders
+    int lengthA, lengthB;
+
+    // retrieve the chars of the above arguments (NULL for unflattened ropes)
+    NUC_CONCAT_CAST(b, lengthB, bufferB, 0);
+    NUC_CONCAT_CAST(a, lengthA, bufferA, 1);
+
+    // ropes are always long, so are never copied below
+    int length = lengthA + lengthB;
+    if (length >= NUC_ROPE_MIN_LENGTH) {
+        nuc_ObjString* right = quantise_concatString(b, lengthB, 0);
+        nuc_ObjString* left = quantise_concatString(a, lengthA, 1);
+        nuc_ObjString* res = objString_rope(left, right);
+        POP_DOUBLE();  // pop the args
+        PUSH(NUC_OBJ(res));
+        return true;
+    }
 
-    // and now can continue with concatenation
-    int length = a->length + b->length;
-    char* chars = NUC_ALLOC(char, length + 1);
-    memcpy(chars, a->chars, a->length);
-    memcpy(chars + a->length, b->chars, b->length);
-    chars[length] = '\0';
+    // otherwise can continue with concatenation (the arguments stay on the stack until complete)
+    nuc_ObjString* res = objString_reserve(length);
+    memcpy(res->inlined, a, lengthA);
+    memcpy(res->inlined + lengthA, b, lengthB);
 
     // and PUSH the result back onto the stack
-    nuc_ObjString* res = objString_take(chars, length);
     POP_DOUBLE();  // pop the args
     PUSH(NUC_OBJ(res));
     return true;  // denote success
 }
 
-/**
- * Helper method for `quantise_repeat` to optimize what would have
- * been iterated "strcat" methods.
- * @param s                     String to concat.
- * @param a                     Item to concatenate.
- */
-static inline char* quatise_repeat__strcat(char* s, char* a) {
-    while (*s != '\0') s++;
-    while (*a != '\0') *s++ = *a++;
-    *s = '\0';
-    return s;
-}
-
 /**
  * Repeats a string by a certain number of times.
  * @param dir                   Direction of either NS or SN
@@ -87,15 +106,12 @@ static inline void quantise_repeat(bool dir) {
         return;
     }
 
-    // otherwise want to coordinate repeating the string
-    int length = (string->length) * count + count;
-    char* chars = NUC_ALLOC(char, length);
-    *chars = '\0';
-    char* tmp = quatise_repeat__strcat(chars, string->chars);  // need to sub 1 below, since preempt ONCE
-    for (int i = 0; i < count - 1; i++) tmp = quatise_repeat__strcat(tmp, string->chars);
+    // otherwise want to coordinate repeating the string (copying by length, rather than rescanning)
+    const char* source = objString_flatten(string);
+    nuc_ObjString* res = objString_reserve(string->length * count);
+    for (int i = 0; i < count; i++) memcpy(res->inlined + i * string->length, source, string->length);
 
     // and now POP and PUSH the new result
-    nuc_ObjString* res = objString_take(chars, length);
     POP_DOUBLE();
     PUSH(NUC_OBJ(res));
 }
@@ -118,14 +134,18 @@ static inline bool quantise_isFalsey(nuc_Particle value) {
 }
 
 /**
- * Checks if two particles are the the same either by value (numbers) or
+ * Checks if two particles are the the same either by value (numbers / strings) or
  * by given pointer locations.
  * @param a                             Particle A to compare.
  * @param b                             Particle B to compare.
  */
 static inline bool quantise_isEqual(nuc_Particle a, nuc_Particle b) {
     if (IS_NUMBER(a) && IS_NUMBER(b)) return AS_NUMBER(a) == AS_NUMBER(b);
-    return a == b;  // since NAN boxing, can check pointers
+    if (a == b) return true;  // since NAN boxing, can check pointers
+
+    // strings that have not been interned may still have the same chars
+    if (IS_STRING(a) && IS_STRING(b)) return objString_equals(AS_STRING(a), AS_STRING(b));
+    return false;
 }
 
 /**
@@ -137,7 +157,7 @@ static inline bool quantise_isLess(nuc_Particle a, nuc_Particle b) {
     if (IS_NUMBER(a) && IS_NUMBER(b)) {
         return AS_NUMBER(a) < AS_NUMBER(b);
     } else if (IS_STRING(a) && IS_STRING(b)) {
-        return strcmp(AS_STRING(a)->chars, AS_STRING(b)->chars) < 0;
+        return strcmp(AS_CSTRING(a), AS_CSTRING(b)) < 0;
     }
 
     // otherwise will result in a catchable runtime error
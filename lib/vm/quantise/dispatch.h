@@ -0,0 +1,155 @@
+#ifndef NUC_QUANTISE_DISPATCH_H
+#define NUC_QUANTISE_DISPATCH_H
+
+// Nucleus Headers
+#include "../../bytecode/ops.h"
+#include "../../common.h"
+
+/*******************
+ *  DEBUG DISPLAY  *
+ *******************/
+
+#ifdef NUC_DEBUG_TRACE
+/**
+ * Displays the current stack / instruction about to be quantised.
+ * @param frame                     Frame currently being quantised.
+ */
+static inline void quantise_trace(nuc_CallFrame* frame) {
+    #ifdef NUC_DEBUG_STACK_TRACE  // display stack
+    printf("[\x1b[2;36mstack\x1b[0m]  ");
+    for (nuc_Particle* slot = atomizer.stack; slot < atomizer.top; slot++) {
+        printf("[ ");
+        particle_print(*slot, true);
+        printf(" ]");
+    }
+    putchar('\n');
+    #endif
+
+    // and also coordinate
+    #ifdef NUC_DEBUG_OP_TRACE  // displays operation
+    nuc_disassembleInstruction(
+        &frame->closure->reaction->chunk,
+        (int)(frame->ip - frame->closure->reaction->chunk.code),
+        "\n[\x1b[2;32mtrace\x1b[0m]");
+    #endif
+}
+
+    #define QUANTISE_TRACE() (SPILL(), quantise_trace(frame))
+#else
+    #define QUANTISE_TRACE()
+#endif
+
+/*********************
+ *  DISPATCH MACROS  *
+ *********************/
+
+#ifdef NUC_THREADED_DISPATCH
+
+/** Label name of an operation handler. */
+    #define OP_LABEL(op) __quantise_##op
+
+/** Jumps straight to the handler of the next instruction (threaded dispatch). */
+    #define DISPATCH()                                   \
+        do {                                             \
+            QUANTISE_TRACE();                            \
+            goto* __quantise_dispatch[inst = READ_BYTE()]; \
+        } while (0)
+
+    #define DISPATCH_LOOP DISPATCH();                    // enters the handlers
+    #define CASE(op) OP_LABEL(op)                        // marks an operation handler
+    #define CASE_UNKNOWN OP_LABEL(UNKNOWN)               // marks the unknown operation handler
+    #define NEXT DISPATCH()                              // continues to the next instruction
+    #define DISRUPT goto OP_LABEL(DISRUPTED)             // exits to the disruption handler
+    #define DISRUPTION_HANDLER OP_LABEL(DISRUPTED) : ;  // marks the disruption handler
+
+/**
+ * Maps each bytecode operation to the label of its handler. The handlers are listed in the order of
+ * the operations, with the rest of the table filled with the unknown handler on first entry.
+ */
+    #define DISPATCH_TABLE                                 \
+        static void* __quantise_dispatch[UINT8_COUNT] = {  \
+            &&OP_LABEL(OP_FALSE),                          \
+            &&OP_LABEL(OP_TRUE),                           \
+            &&OP_LABEL(OP_NULL),                           \
+            &&OP_LABEL(OP_NEGATE),                         \
+            &&OP_LABEL(OP_ADD),                            \
+            &&OP_LABEL(OP_SUB),                            \
+            &&OP_LABEL(OP_MUL),                            \
+            &&OP_LABEL(OP_DIV),                            \
+            &&OP_LABEL(OP_MOD),                            \
+            &&OP_LABEL(OP_POW),                            \
+            &&OP_LABEL(OP_XOR),                            \
+            &&OP_LABEL(OP_BITW_OR),                        \
+            &&OP_LABEL(OP_BITW_AND),                       \
+            &&OP_LABEL(OP_BITW_NOT),                       \
+            &&OP_LABEL(OP_ROL),                            \
+            &&OP_LABEL(OP_ROR),                            \
+            &&OP_LABEL(OP_NOT),                            \
+            &&OP_LABEL(OP_EQUAL),                          \
+            &&OP_LABEL(OP_GREATER),                        \
+            &&OP_LABEL(OP_LESS),                           \
+            &&OP_LABEL(OP_POP),                            \
+            &&OP_LABEL(OP_CATCH_MODE),                     \
+            &&OP_LABEL(OP_END_CATCH_MODE),                 \
+            &&OP_LABEL(OP_RETURN),                         \
+            &&OP_LABEL(OP_JUMP),                           \
+            &&OP_LABEL(OP_JUMP_IF_FALSE),                  \
+            &&OP_LABEL(OP_JUMP_IF_FALSE_OR_POP),           \
+            &&OP_LABEL(OP_POP_JUMP_IF_FALSE),              \
+            &&OP_LABEL(OP_JUMP_CATCH),                     \
+            &&OP_LABEL(OP_LOOP),                           \
+            &&OP_LABEL(OP_FOR_NUM_PREP),                   \
+            &&OP_LABEL(OP_FOR_NUM_LOOP),                   \
+            &&OP_LABEL(OP_CONSTANT),                       \
+            &&OP_LABEL(OP_DEFINE_GLOBAL_SLOT),             \
+            &&OP_LABEL(OP_GET_GLOBAL_SLOT),                \
+            &&OP_LABEL(OP_SET_GLOBAL_SLOT),                \
+            &&OP_LABEL(OP_SET_LOCAL),                      \
+            &&OP_LABEL(OP_GET_LOCAL),                      \
+            &&OP_LABEL(OP_SET_UPVALUE),                    \
+            &&OP_LABEL(OP_GET_UPVALUE),                    \
+            &&OP_LABEL(OP_CLOSE_UPVALUE),                  \
+            &&OP_LABEL(OP_CALL),                           \
+            &&OP_LABEL(OP_CLOSURE),                        \
+            &&OP_LABEL(OP_INVOKE),                         \
+            &&OP_LABEL(OP_FIELD),                          \
+            &&OP_LABEL(OP_METHOD),                         \
+            &&OP_LABEL(OP_GET_PROPERTY),                   \
+            &&OP_LABEL(OP_SET_PROPERTY),                   \
+            &&OP_LABEL(OP_SET_BASE_PROPERTY),              \
+            &&OP_LABEL(OP_ARRAY),                          \
+            &&OP_LABEL(OP_GET_MEMBER),                     \
+            &&OP_LABEL(OP_SET_MEMBER),                     \
+            &&OP_LABEL(OP_MODEL),                          \
+            &&OP_LABEL(OP_INHERIT),                        \
+            &&OP_LABEL(OP_GET_SUPER),                      \
+            &&OP_LABEL(OP_SUPER_INVOKE),                   \
+            &&OP_LABEL(UNKNOWN), /* OP_MUTATE */           \
+            &&OP_LABEL(UNKNOWN), /* OP_SET_IMMUTABLE */    \
+            &&OP_LABEL(OP_GET_NATIVE),                     \
+            &&OP_LABEL(OP_CALL_NATIVE),                    \
+            &&OP_LABEL(OP_CALL_NATIVE_NUM),                \
+            &&OP_LABEL(OP_LOCAL_LT_CONST_JUMP),            \
+            &&OP_LABEL(OP_ADD_LOCALS),                     \
+            &&OP_LABEL(OP_SUB_LOCAL_CONST),                \
+            &&OP_LABEL(OP_SUB_LOCAL_CONST_CALL),           \
+        };                                                 \
+        if (__quantise_dispatch[UINT8_MAX] == NULL)        \
+            for (int op = OP_COUNT; op < UINT8_COUNT; op++) __quantise_dispatch[op] = &&OP_LABEL(UNKNOWN)
+
+#else
+
+    #define DISPATCH_LOOP     \
+        QUANTISE_TRACE();     \
+        switch (inst = READ_BYTE())
+
+    #define CASE(op) case op         // marks an operation handler
+    #define CASE_UNKNOWN default     // marks the unknown operation handler
+    #define NEXT continue            // continues to the next instruction
+    #define DISRUPT break            // exits to the disruption handler
+    #define DISRUPTION_HANDLER       // disruptions simply fall out of the switch
+    #define DISPATCH_TABLE           // no table required for a switch
+
+#endif
+
+#endif
@@ -9,7 +9,10 @@
 #include "stdlib.h"
 
 // FORWARD DECLARATION
-static inline nuc_Particle atomizer_resolveNative(nuc_ObjString* name);
+static inline nuc_Particle atomizer_boxNative(int index);
+static inline nuc_NativeReaction atomizer_nativeReaction(int index);
+static inline const nuc_NativeFastCall* atomizer_nativeFastCall(int index);
+static void atomizer_quantiseRegisters();
 
 // conditional includes
 #ifdef NUC_DEBUG_PRINT_CODE
@@ -20,30 +23,74 @@ static inline nuc_Particle atomizer_resolveNative(nuc_ObjString* name);
  *  INTERNAL MACROS  *
  *********************/
 
-/** Reads one byte from the current FRAME. */
-#define READ_BYTE() (*frame->ip++)
+/** Reads one byte from the cached instruction pointer. */
+#define READ_BYTE() (*ip++)
 
-/** Reads a short (two bytes) from the current FRAME. */
-#define READ_SHORT() (frame->ip += 2, (uint16_t)(((frame->ip[-2] << 8) | frame->ip[-1])))
+/** Reads a short (two bytes) from the cached instruction pointer. */
+#define READ_SHORT() (ip += 2, (uint16_t)(((ip[-2] << 8) | ip[-1])))
 
-/** Reads an address (four bytes) from the current FRAME. */
-#define READ_ADDR() (frame->ip += 4, (uint32_t)(((frame->ip[-4] << 24) | (frame->ip[-3] << 16) | (frame->ip[-2] << 8) | frame->ip[-1])))
+/** Reads an address (four bytes) from the cached instruction pointer. */
+#define READ_ADDR() (ip += 4, (uint32_t)(((ip[-4] << 24) | (ip[-3] << 16) | (ip[-2] << 8) | ip[-1])))
 
-/** Reads a constant from the available chunk constants. */
-#define READ_CONSTANT() (frame->closure->reaction->chunk.constants.values[READ_SHORT()])
+/** Reads a constant from the cached chunk constants. */
+#define READ_CONSTANT() (constants[READ_SHORT()])
 
 /** Reads a string constant from the current frame. */
 #define READ_STRING() AS_STRING(READ_CONSTANT())
 
-/** Confirms the top two items on the stack are numerics. */
-#define EXPECT_NUMERICS(op)                                                                            \
-    if (!IS_NUMBER(PEEK(0)) || !IS_NUMBER(PEEK(1))) {                                                  \
-        atomizer_catchableError(NUC_EXIT_TYPE, "The \"" #op "\" operator expected numeric operands."); \
-        break;                                                                                         \
-    }
+/** Reads the inline cache of the current instruction from the current frame. */
+#define READ_CACHE() (&frame->closure->reaction->chunk.caches.sites[READ_SHORT()])
+
+/** Reads a local slot from the cached slots (NULL if the slot has not been pushed). */
+#define READ_LOCAL() quantise_readLocal(slots, top, READ_SHORT())
+
+/**
+ * The loop keeps the instruction pointer, slots, stack top and constants of the current FRAME in
+ * locals. The ip / stack top are SPILLED back to the FRAME / atomizer before anything outside the
+ * loop may inspect them (calls, natives, allocations that may collect garbage, disruptions), and
+ * the stack top is RELOADED afterwards.
+ */
+#define SPILL() (frame->ip = ip, atomizer.top = top)
+
+/** Reloads the cached stack top after a spilled call. */
+#define RELOAD() (top = atomizer.top)
 
-#define CONTINUE \
-    continue;    \
+/** Loads the cached state of the current FRAME. */
+#define LOAD_FRAME()                                                  \
+    do {                                                              \
+        frame = &atomizer.frames[atomizer.frameCount - 1];            \
+        ip = frame->ip;                                               \
+        slots = frame->slots;                                         \
+        constants = frame->closure->reaction->chunk.constants.values; \
+    } while (0)
+
+/**
+ * Updates the current FRAME after a spilled call. Register tier reactions are run to completion by
+ * the register loop, so afterwards the calling frame is current again.
+ */
+#define ENTER_FRAME()                                                                              \
+    if (atomizer.frames[atomizer.frameCount - 1].closure->reaction->tier == NUC_TIER_REGISTER) { \
+        atomizer_quantiseRegisters();                                                            \
+        RELOAD();                                                                                \
+        if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) {                                              \
+            if (atomizer.frameCount > 0) LOAD_FRAME();                                           \
+            DISRUPT;                                                                             \
+        }                                                                                        \
+    }                                                                                            \
+    LOAD_FRAME();                                                                                \
+    RELOAD()
+
+/** Raises a catchable disruption (spilling the cached state for the error trace). */
+#define CATCHABLE_ERROR(code, ...)                   \
+    SPILL();                                         \
+    atomizer_catchableError(code, __VA_ARGS__);      \
+    RELOAD()
+
+/** Confirms the top two items on the stack are numerics. */
+#define EXPECT_NUMERICS(op)                                                                       \
+    if (!IS_NUMBER(PEEK(0)) || !IS_NUMBER(PEEK(1))) {                                             \
+        CATCHABLE_ERROR(NUC_EXIT_TYPE, "The \"" #op "\" operator expected numeric operands."); \
+        DISRUPT;                                                                                  \
     }
 
 /** POPS two particles of the Stack as A and B. */
@@ -91,9 +138,15 @@ static inline nuc_Particle atomizer_resolveNative(nuc_ObjString* name);
  * @param op                    Operator to use.
  */
 #define CASE_OPERATOR(opcode, METHOD, type, op) \
-    case opcode:                                \
+    CASE(opcode):                               \
         METHOD##_BIN_OP(type, op);              \
-        continue
+        NEXT
+
+/**********************
+ *  DISPATCH METHODS  *
+ **********************/
+
+#include "dispatch.h"  // instruction dispatching
 
 /******************
  *  CASE METHODS  *
@@ -102,52 +155,68 @@ static inline nuc_Particle atomizer_resolveNative(nuc_ObjString* name);
 #include "case/member.h"    // member access
 #include "case/operator.h"  // operator cases
 
+/**
+ * Reads a local slot of a frame. Slots past the top of the stack (ie: missing defaulted
+ * arguments) are read as NULL, matching OP_GET_LOCAL.
+ * @param slots                     Slots of the frame.
+ * @param top                       Current stack top.
+ * @param slot                      Slot to read.
+ */
+static inline nuc_Particle quantise_readLocal(nuc_Particle* slots, nuc_Particle* top, uint16_t slot) {
+    return slot < top - slots ? slots[slot] : NUC_NULL;
+}
+
+/**
+ * Unwinds a catchable disruption out of every frame from a given frame upwards. The disruption
+ * is left where the result of the call to the frame would have been.
+ * @param baseFrame                 Lowest frame (1-indexed) to unwind.
+ */
+static void quantise_unwind(int baseFrame) {
+    nuc_Particle disruption = POP();
+    nuc_CallFrame* base = &atomizer.frames[baseFrame - 1];
+    nuc_upvalue_closeAll(base->slots);
+    atomizer.frameCount = baseFrame - 1;
+    atomizer.top = base->slots;
+    PUSH(disruption);
+}
+
 /******************
  *  QUANTISATION  *
  ******************/
 
+// the loop works on the cached stack top rather than `atomizer.top`
+#undef PUSH
+#undef POP
+#undef PEEK
+#define PUSH(val) (*top++ = (val))
+#define POP() (*--top)
+#define PEEK(dist) (top[-1 - (dist)])
+
 /**
- * Coordinates the MAIN virtual machine loop for Nucleus atomization. This method
+ * Coordinates the STACK virtual machine loop for Nucleus atomization. This method
  * iterates over a current call frame's compiled bytecode and executes instructions
- * as required. 
+ * as required, until the frame that entered the loop returns.
  */
-void atomizer_quantise() {
-    // set a call frame reference to use for instructions
-    nuc_CallFrame* frame = &atomizer.frames[atomizer.frameCount - 1];
+static void atomizer_quantiseStack() {
+    // cache the current call frame state in locals
+    nuc_CallFrame* frame;
+    uint8_t* ip;
+    nuc_Particle* slots;
+    nuc_Particle* constants;
+    nuc_Particle* top = atomizer.top;
+    LOAD_FRAME();
+
+    int baseFrame = atomizer.frameCount;  // frame that entered the loop
     uintptr_t catchBlockIP = 0x00;  // set EMPTY catch block IP
+    DISPATCH_TABLE;                 // and the threaded dispatch table (if supported)
 
     for (;;) {
-/*******************
- *  DEBUG DISPLAY  *
- *******************/
-#ifdef NUC_DEBUG_TRACE
-    #ifdef NUC_DEBUG_STACK_TRACE  // display stack
-        printf("[\x1b[2;36mstack\x1b[0m]  ");
-        for (nuc_Particle* slot = atomizer.stack; slot < atomizer.top; slot++) {
-            printf("[ ");
-            particle_print(*slot, true);
-            printf(" ]");
-        }
-        putchar('\n');
-    #endif
-
-    // and also coordinate
-    #ifdef NUC_DEBUG_OP_TRACE  // displays operation
-        nuc_disassembleInstruction(
-            &frame->closure->reaction->chunk,
-            (int)(frame->ip - frame->closure->reaction->chunk.code),
-            "\n[\x1b[2;32mtrace\x1b[0m]");
-    #endif
-
-            // putchar('\n');
-#endif
-
         /************************
          *  OPERATION HANDLING  *
          ************************/
 
         uint8_t inst;  // placeholder for the current instruction
-        switch (inst = READ_BYTE()) {
+        DISPATCH_LOOP {
             /*********************
              *  MATH OPERATIONS  *
              *********************/
@@ -162,346 +231,435 @@ void atomizer_quantise() {
             // modulo needs to be completed as fmod(), this can be quicker for
             // native integers on some machines so best to use it for ALL modulo
             // operations
-            case OP_MOD: {
+            CASE(OP_MOD): {
                 EXPECT_NUMERICS(%);  // want to expect two numerics
                 double b = AS_NUMBER(POP());
                 double a = AS_NUMBER(POP());
                 PUSH(NUC_NUM(fmod(a, b)));
-                continue;
+                NEXT;
             }
 
             // power of needs to be completed with pow(), since C has no in-built operator
             // to coordinate doing so
-            case OP_POW: {
+            CASE(OP_POW): {
                 EXPECT_NUMERICS(**);  // want to expect two numerics
                 double b = AS_NUMBER(POP());
                 double a = AS_NUMBER(POP());
                 PUSH(NUC_NUM(pow(a, b)));
-                continue;
+                NEXT;
             }
 
             // the ADD instruction allows concatenation for strings / numerics,
             // otherwise handles straight numerics simply, and for the rest will return NULL
-            case OP_ADD: {
+            CASE(OP_ADD): {
                 // if both numerics then handle immediately
                 if (IS_NUMBER(PEEK(0)) && IS_NUMBER(PEEK(1))) {
                     NUMERIC_BIN_OP(NUC_NUM, +);
-                    continue;
+                    NEXT;
                 }
 
                 // otherwise we want a pair of either SS, SN or NS
-                if (quantise_concat()) continue;  // coordinates concatentation
-                break;                            // break for error handling
+                SPILL();
+                bool concatenated = quantise_concat();  // coordinates concatentation
+                RELOAD();
+                if (concatenated) NEXT;
+                DISRUPT;  // break for error handling
             }
 
             // the MUL instruction allows for string repetition by MULTIPLYING
             // a given string. Otherwise expects straight numerics
-            case OP_MUL: {
+            CASE(OP_MUL): {
                 if (IS_STRING(PEEK(0)) && IS_NUMBER(PEEK(1))) {  // if SN
+                    SPILL();
                     quantise_repeat(NUC_REPEAT_SN);
-                    continue;
+                    RELOAD();
+                    NEXT;
                 } else if (IS_NUMBER(PEEK(0)) && IS_STRING(PEEK(1))) {  // or NS
+                    SPILL();
                     quantise_repeat(NUC_REPEAT_NS);
-                    continue;
+                    RELOAD();
+                    NEXT;
                 }
 
                 // otherwise EXPECT numerics
                 NUMERIC_BIN_OP(NUC_NUM, *);
-                continue;
+                NEXT;
             }
 
             // NEGATION simply type checks and returns the negative of a given top of stack.
-            case OP_NEGATE: {
+            CASE(OP_NEGATE): {
                 if (!IS_NUMBER(PEEK(0))) {
-                    atomizer_catchableError(NUC_EXIT_TYPE, "The \"-\" unary operator expects a numeric operand.");
-                    break;
+                    CATCHABLE_ERROR(NUC_EXIT_TYPE, "The \"-\" unary operator expects a numeric operand.");
+                    DISRUPT;
                 }
-                PUSH(NUC_NUM(-AS_NUMBER(POP())));
-                continue;
+                nuc_Particle value = POP();
+                PUSH(NUC_NUM(-AS_NUMBER(value)));
+                NEXT;
             }
 
             // BITWISE NOT simply type checks for a numeric, then casts the numeric to
             // a integer to perform bitwise logic
-            case OP_BITW_NOT: {
+            CASE(OP_BITW_NOT): {
                 if (!IS_NUMBER(PEEK(0))) {
-                    atomizer_catchableError(NUC_EXIT_TYPE, "The \"~\" unary operator expects a numeric operand.");
-                    break;
+                    CATCHABLE_ERROR(NUC_EXIT_TYPE, "The \"~\" unary operator expects a numeric operand.");
+                    DISRUPT;
                 }
-                PUSH(NUC_NUM(~(int32_t)AS_NUMBER(POP())));
-                continue;
+                nuc_Particle value = POP();
+                PUSH(NUC_NUM(~(int32_t)AS_NUMBER(value)));
+                NEXT;
             }
 
             // NOT inverses and returns the boolean result of ANY particle. Empty base models,
             // empty strings, and empty arrays will return "true" here as the are logically false.
-            case OP_NOT: {
-                PUSH(NUC_BOOL(quantise_isFalsey(POP())));
-                continue;
+            CASE(OP_NOT): {
+                nuc_Particle value = POP();
+                PUSH(NUC_BOOL(quantise_isFalsey(value)));
+                NEXT;
             }
 
             // EQUAL simply compares two particles are the same
-            case OP_EQUAL: {
-                PUSH(NUC_BOOL(quantise_isEqual(POP(), POP())));
-                continue;
+            CASE(OP_EQUAL): {
+                nuc_Particle b = POP();
+                nuc_Particle a = POP();
+                PUSH(NUC_BOOL(quantise_isEqual(a, b)));
+                NEXT;
             }
 
             // LESS compares LEFT to RIGHT that (a < b). If an invalid type arrangement is given, and error is
             // set up to be catchable and can be handle IMMEDIATELY after this instruction
-            case OP_LESS: {
+            CASE(OP_LESS): {
                 POP_AB();
+                SPILL();
                 bool res = quantise_isLess(a, b);
+                RELOAD();
                 if (!NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) {
                     PUSH(NUC_BOOL(res));
-                    continue;
+                    NEXT;
                 }
-            } break;
+            } DISRUPT;
 
             // GREATER compares RIGHT to LEFT that (b < a). Again if an invalid type arrangement is given,
             // a type error is set up to be CAUGHT if needed
-            case OP_GREATER: {
-                bool res = quantise_isLess(POP(), POP());
+            CASE(OP_GREATER): {
+                POP_AB();
+                SPILL();
+                bool res = quantise_isLess(b, a);
+                RELOAD();
                 if (!NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) {
                     PUSH(NUC_BOOL(res));
-                    continue;
+                    NEXT;
                 }
-            } break;
+            } DISRUPT;
 
             /***********************************
              *  CONSTANT / LITERAL OPERATIONS  *
              ***********************************/
-            case OP_CONSTANT: {
+            CASE(OP_CONSTANT): {
                 PUSH(READ_CONSTANT());
-                continue;
+                NEXT;
             }
-            case OP_NULL: {
+            CASE(OP_NULL): {
                 PUSH(NUC_NULL);
-                continue;
+                NEXT;
             }
-            case OP_TRUE: {
+            CASE(OP_TRUE): {
                 PUSH(NUC_TRUE);
-                continue;
+                NEXT;
             }
-            case OP_FALSE: {
-                PUSH(OP_FALSE);
-                continue;
+            CASE(OP_FALSE): {
+                PUSH(NUC_FALSE);
+                NEXT;
             }
 
             /************************
              *  CONTROL OPERATIONS  *
              ************************/
-            case OP_RETURN: {  // handles return keyword / exiting of script
+            CASE(OP_RETURN): {  // handles return keyword / exiting of script
                 nuc_Particle res = POP();
-                nuc_upvalue_closeAll(frame->slots);  // close the frames upvalues
-                atomizer.frameCount--;               // and decrement the frame count
+                nuc_upvalue_closeAll(slots);  // close the frames upvalues
+                atomizer.frameCount--;        // and decrement the frame count
 
-                // if still frames, then continue
+                // if still frames, then continue (unless returning out of this loop)
                 if (atomizer.frameCount > 0) {
-                    atomizer.top = frame->slots;
+                    top = slots;
                     PUSH(res);
-                    frame = &atomizer.frames[atomizer.frameCount - 1];
-                    continue;
+                    atomizer.top = top;
+                    if (atomizer.frameCount < baseFrame) return;
+                    LOAD_FRAME();
+                    NEXT;
                 }
 
                 // otherwise no more frames to run
-                POP();
+                atomizer.top = top - 1;
                 return;
             }
 
             // SETS the atomizer into a CATCHABLE state
-            case OP_CATCH_MODE: {
+            CASE(OP_CATCH_MODE): {
                 NUC_SET_AFLAG(NUC_AFLAG_DISRUPTION_CATCHABLE);
-                continue;
+                NEXT;
             }
 
             // ENDS the CATCHABLE atomizer state if currently set
-            case OP_END_CATCH_MODE: {
+            CASE(OP_END_CATCH_MODE): {
                 NUC_UNSET_AFLAG(NUC_AFLAG_DISRUPTION_CATCHABLE);
-                continue;
+                NEXT;
             }
 
             // found a request to JUMP to a given address
-            case OP_JUMP: {
+            CASE(OP_JUMP): {
                 uint32_t offset = READ_ADDR();
-                frame->ip += offset;
-                continue;
+                ip += offset;
+                NEXT;
             };
 
             // found a request to JUMP but only if the top of the stack is false
-            case OP_JUMP_IF_FALSE: {
+            CASE(OP_JUMP_IF_FALSE): {
                 uint32_t offset = READ_ADDR();
-                if (quantise_isFalsey(PEEK(0))) frame->ip += offset;
-                continue;
+                if (quantise_isFalsey(PEEK(0))) ip += offset;
+                NEXT;
             }
 
             // found a request to jump, otherwise to POP
-            case OP_JUMP_IF_FALSE_OR_POP: {
+            CASE(OP_JUMP_IF_FALSE_OR_POP): {
                 uint32_t offset = READ_ADDR();
                 if (quantise_isFalsey(PEEK(0))) {
-                    frame->ip += offset;  // if false then JUMP
+                    ip += offset;  // if false then JUMP
                 } else {
-                    POP();  // otherwise want to POP
+                    top--;  // otherwise want to POP
                 }
-                continue;
+                NEXT;
+            }
+
+            // found a request to jump, with the condition popped either way
+            CASE(OP_POP_JUMP_IF_FALSE): {
+                uint32_t offset = READ_ADDR();
+                if (quantise_isFalsey(POP())) ip += offset;
+                NEXT;
             }
 
             // saves a CATCH jump to execute when an error is caught
-            case OP_JUMP_CATCH: {
-                catchBlockIP = READ_ADDR() + (uintptr_t)frame->ip;
-                continue;
+            CASE(OP_JUMP_CATCH): {
+                catchBlockIP = READ_ADDR() + (uintptr_t)ip;
+                NEXT;
             }
 
             // request to LOOP so decrement to start of loop
-            case OP_LOOP: {
+            CASE(OP_LOOP): {
                 uint32_t offset = READ_ADDR();
-                frame->ip -= offset;
-                continue;
+                ip -= offset;
+                NEXT;
+            }
+
+            // enters a numeric 'for' loop, skipping it if the variable already matches the limit
+            CASE(OP_FOR_NUM_PREP): {
+                nuc_Particle variable = slots[READ_SHORT()];
+                nuc_Particle limit = slots[READ_SHORT()];
+                uint32_t offset = READ_ADDR();
+                if (quantise_isEqual(variable, limit)) ip += offset;
+                NEXT;
+            }
+
+            // steps a numeric 'for' loop variable (the step is always numeric), and loops back to
+            // the body whilst it differs from the limit. Non-numeric variables are concatenated.
+            CASE(OP_FOR_NUM_LOOP): {
+                nuc_Particle* variable = &slots[READ_SHORT()];
+                nuc_Particle limit = slots[READ_SHORT()];
+                double step = AS_NUMBER(slots[READ_SHORT()]);
+                uint32_t offset = READ_ADDR();
+                if (IS_NUMBER(*variable) && IS_NUMBER(limit)) {
+                    double next = AS_NUMBER(*variable) + step;
+                    *variable = NUC_NUM(next);
+                    if (next != AS_NUMBER(limit)) ip -= offset;
+                    NEXT;
+                }
+
+                // otherwise step as the generic addition would
+                if (IS_NUMBER(*variable)) {
+                    *variable = NUC_NUM(AS_NUMBER(*variable) + step);
+                } else {
+                    PUSH(*variable);
+                    PUSH(NUC_NUM(step));
+                    SPILL();
+                    bool concatenated = quantise_concat();
+                    RELOAD();
+                    if (!concatenated) DISRUPT;
+                    *variable = POP();
+                }
+                if (!quantise_isEqual(*variable, limit)) ip -= offset;
+                NEXT;
             }
 
             /*********************
              *  CALL OPERATIONS  *
              *********************/
-            case OP_CALL: {
+            CASE(OP_CALL): {
                 int argCount = READ_BYTE();
-                if (!atomizer_callValue(PEEK(argCount), argCount)) break;  // allow errors to be caught AFTER switch case
-                frame = &atomizer.frames[atomizer.frameCount - 1];
-                continue;  // no errors so immediately continue
+                SPILL();
+                if (!atomizer_callValue(PEEK(argCount), argCount)) {
+                    RELOAD();
+                    DISRUPT;  // allow errors to be caught AFTER switch case
+                }
+                ENTER_FRAME();
+                NEXT;  // no errors so immediately continue
             }
 
             // handles requests to make CLOSURES from a given reaction constant.
-            case OP_CLOSURE: {
+            CASE(OP_CLOSURE): {
                 nuc_ObjReaction* reaction = AS_REACTION(READ_CONSTANT());
+                SPILL();  // allocations may collect garbage
                 nuc_ObjClosure* closure = closure_new(reaction);
                 PUSH(NUC_OBJ(closure));
+                SPILL();
 
                 // now want to capture upvalues for the closure
                 for (int i = 0; i < closure->uvCount; i++) {
                     uint8_t isLocal = READ_BYTE();
                     uint16_t index = READ_SHORT();
                     if (isLocal) {
-                        closure->upvalues[i] = upvalue_capture(frame->slots + index);
+                        closure->upvalues[i] = upvalue_capture(slots + index);
                     } else {
                         closure->upvalues[i] = frame->closure->upvalues[index];
                     }
+                    gc_writeBarrier((nuc_Obj*)closure, NUC_OBJ(closure->upvalues[i]));  // captures may collect garbage
                 }
 
-                continue;
+                NEXT;
             }
 
             /*************************
              *  VARIABLE OPERATIONS  *
              *************************/
-            case OP_POP: {
-                POP();  // simply pops the top of the stack
-                continue;
+            CASE(OP_POP): {
+                top--;  // simply pops the top of the stack
+                NEXT;
             }
 
-            // Defines a GLOBAL variable that gets added to the atomizer.globals hash table
-            case OP_DEFINE_GLOBAL: {
-                nuc_ObjString* name = READ_STRING();
-                table_set(&atomizer.globals, name, PEEK(0));
-                POP();
-                continue;
-            }
-
-            // Retrieves a GLOBAL variable from the globals hash table. Throws a reference error if not found.
-            case OP_GET_GLOBAL: {
-                nuc_ObjString* name = READ_STRING();  // read the name of the variable
-                nuc_Particle value;                   // set a placeholder for the reference
-                if (!table_get(&atomizer.globals, name, &value)) {
-                    atomizer_catchableError(NUC_EXIT_REF, "Undefined variable reference to \"%s\".", name->chars);
-                    break;  // allow error handler to complete
+            // Defines a GLOBAL variable into the slot the fuser resolved for its name
+            CASE(OP_DEFINE_GLOBAL_SLOT): {
+                uint16_t slot = READ_SHORT();
+                atomizer.globalSlots.values[slot] = POP();
+                NEXT;
+            }
+
+            // Retrieves a GLOBAL variable from its slot. Throws a reference error if the slot has not
+            // been defined yet.
+            CASE(OP_GET_GLOBAL_SLOT): {
+                uint16_t slot = READ_SHORT();
+                nuc_Particle value = atomizer.globalSlots.values[slot];
+                if (IS_UNDEFINED(value)) {
+                    CATCHABLE_ERROR(NUC_EXIT_REF, "Undefined variable reference to \"%s\".", atomizer_globalName(slot)->chars);
+                    DISRUPT;  // allow error handler to complete
                 }
 
                 PUSH(value);
-                continue;
+                NEXT;
             }
 
-            // Sets a GLOBAL variable by name with the value at the top of the stack. Throws a reference
+            // Sets a GLOBAL variable slot with the value at the top of the stack. Throws a reference
             // error if the variable is not currently defined.
-            case OP_SET_GLOBAL: {
-                nuc_ObjString* name = READ_STRING();  // read the name of variable
-                nuc_Particle value;                   // and set placeholder for reference
-
-                // check the value exists
-                if (!table_get(&atomizer.globals, name, &value)) {
-                    atomizer_catchableError(NUC_EXIT_REF, "Tried to set an undefined variable \"%s\".", name->chars);
-                    table_delete(&atomizer.globals, name);  // clear up item
-                    break;
+            CASE(OP_SET_GLOBAL_SLOT): {
+                uint16_t slot = READ_SHORT();
+                if (IS_UNDEFINED(atomizer.globalSlots.values[slot])) {
+                    CATCHABLE_ERROR(NUC_EXIT_REF, "Tried to set an undefined variable \"%s\".", atomizer_globalName(slot)->chars);
+                    DISRUPT;
                 }
 
-                // and set back to globals as confident exists
-                table_set(&atomizer.globals, name, PEEK(0));
-                continue;
+                atomizer.globalSlots.values[slot] = PEEK(0);
+                NEXT;
             }
 
             // Gets a global based on the given slot. The slot refers to index on the stack.
-            case OP_GET_LOCAL: {
+            CASE(OP_GET_LOCAL): {
                 uint16_t slot = READ_SHORT();
-                if (slot >= atomizer.top - frame->slots) {
+                if (slot >= top - slots) {
                     PUSH(NUC_NULL);  // exceeded to the total slots available to push the NULL result
-                    continue;
+                    NEXT;
                 }
 
                 // otherwise valid retrival
-                PUSH(frame->slots[slot]);
-                continue;
+                PUSH(slots[slot]);
+                NEXT;
             }
 
             // Sets a local variable with the current top of the atomizer stack.
-            case OP_SET_LOCAL: {
+            CASE(OP_SET_LOCAL): {
                 uint16_t slot = READ_SHORT();
-                frame->slots[slot] = PEEK(0);
-                continue;
+                slots[slot] = PEEK(0);
+                NEXT;
             }
 
             // Retrieves an upvalue from the current frames closure. Uses the location property
             // which is a pointer reference to the upvalue.
-            case OP_GET_UPVALUE: {
+            CASE(OP_GET_UPVALUE): {
                 uint16_t slot = READ_SHORT();
                 PUSH(*frame->closure->upvalues[slot]->location);
-                continue;
+                NEXT;
             }
 
             // Sets an upvalue by slot. Uses the location property to pass a pointer reference to
             // the new value to set.
-            case OP_SET_UPVALUE: {
-                uint16_t slot = READ_SHORT();
-                *frame->closure->upvalues[slot]->location = PEEK(0);
-                continue;
+            CASE(OP_SET_UPVALUE): {
+                nuc_ObjUpvalue* upvalue = frame->closure->upvalues[READ_SHORT()];
+                gc_writeBarrier((nuc_Obj*)upvalue, PEEK(0));  // (if closed)
+                *upvalue->location = PEEK(0);
+                NEXT;
             }
 
             // Closes upvalues from the last position on the stack.
-            case OP_CLOSE_UPVALUE: {
-                nuc_upvalue_closeAll(atomizer.top - 1);
-                POP();
-                continue;
+            CASE(OP_CLOSE_UPVALUE): {
+                nuc_upvalue_closeAll(top - 1);
+                top--;
+                NEXT;
             }
 
             /*************************
              *  LIBRARY OPERTATIONS  *
              *************************/
-            case OP_GET_NATIVE: {
-                nuc_ObjString* name = READ_STRING();  // read the native name
-
-                // naively attempt to retrieve the native
-                nuc_Particle native;
-                if (table_get(&atomizer.natives, name, &native)) {
-                    PUSH(native);
-                    continue;
+            // Pushes a native (resolved at compile time) as a particle value
+            CASE(OP_GET_NATIVE): {
+                uint16_t index = READ_SHORT();
+                SPILL();  // boxing the native may collect garbage
+                nuc_Particle native = atomizer_boxNative(index);
+                PUSH(native);
+                NEXT;
+            }
+
+            // Calls a native (resolved at compile time) directly, without boxing it as a callee
+            CASE(OP_CALL_NATIVE): {
+                nuc_NativeReaction native = atomizer_nativeReaction(READ_SHORT());
+                int argCount = READ_BYTE();
+                SPILL();
+                bool success = atomizer_callNative(native, argCount);
+                RELOAD();
+                if (!success) DISRUPT;
+                NEXT;
+            }
+
+            // Calls a typed native (resolved at compile time) straight through its unboxed entry
+            // point. Non-numeric arguments fall back to the generic native (which reports the error).
+            CASE(OP_CALL_NATIVE_NUM): {
+                uint16_t index = READ_SHORT();
+                int argCount = READ_BYTE();
+                if (atomizer_callNativeFast(atomizer_nativeFastCall(index), argCount, top - argCount)) {
+                    top -= argCount - 1;
+                    NEXT;
                 }
 
-                // otherwise need to LOAD the native
-                native = atomizer_resolveNative(name);
-                if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) break;
-                PUSH(native);
-                continue;
+                SPILL();
+                bool success = atomizer_callNative(atomizer_nativeReaction(index), argCount);
+                RELOAD();
+                if (!success) DISRUPT;
+                NEXT;
             }
 
             /**********************
              *  ARRAY OPERATIONS  *
              **********************/
-            case OP_ARRAY: {
+            CASE(OP_ARRAY): {
                 // create the new array
                 int arrayCount = READ_SHORT();
+                SPILL();  // allocations may collect garbage
                 nuc_ObjArr* arr = objArr_new(ARR_BASIC);
 
                 // To build the array we need to add each item in ORIGINAL order. This will
@@ -510,179 +668,316 @@ void atomizer_quantise() {
                 // whilst also being the quickest solution WITHOUT shifting items onto the array
                 // as this will take a larger computational cost.
                 for (int i = arrayCount - 1; i >= 0; i--) objArr_push(arr, PEEK(i));
-                for (int i = arrayCount; i > 0; i--) POP();  // and then POP them all
+                top -= arrayCount;  // and then POP them all
 
                 PUSH(NUC_OBJ(arr));  // and push the array onto the stack
-                continue;
+                NEXT;
             }
 
             // coordinates retrieving a MEMBER from an array or model.
-            case OP_GET_MEMBER: {
+            CASE(OP_GET_MEMBER): {
                 // make sure that we have an array or an instance
                 if (IS_ARRAY(PEEK(1))) {
-                    if (quantise_getArrayMember(POP(), AS_ARRAY(POP()))) continue;
+                    nuc_Particle accessor = POP();
+                    nuc_ObjArr* arr = AS_ARRAY(POP());
+                    SPILL();
+                    bool found = quantise_getArrayMember(accessor, arr);
+                    RELOAD();
+                    if (found) NEXT;
                     PUSH(NUC_NULL);  // need to push null in bad accessing
-                    break;
+                    DISRUPT;
                 } else if (IS_INSTANCE(PEEK(1))) {
-                    if (quantise_getModelMember(POP(), AS_INSTANCE(POP()))) continue;
+                    nuc_Particle accessor = POP();
+                    nuc_ObjInstance* instance = AS_INSTANCE(POP());
+                    SPILL();
+                    bool found = quantise_getModelMember(accessor, instance);
+                    RELOAD();
+                    if (found) NEXT;
                     PUSH(NUC_NULL);  // need to push null in bad accessing
-                    break;
+                    DISRUPT;
                 }
 
-                atomizer_catchableError(NUC_EXIT_TYPE, "Only arrays and models allow access to getting members with the square bracket operator.");
-                break;
+                CATCHABLE_ERROR(NUC_EXIT_TYPE, "Only arrays and models allow access to getting members with the square bracket operator.");
+                DISRUPT;
             }
 
             // coordinates setting a MEMBER of an array of model.
-            case OP_SET_MEMBER: {
+            CASE(OP_SET_MEMBER): {
                 // make sure that we have an array or an instance
                 if (IS_ARRAY(PEEK(2))) {
-                    if (!quantise_setArrayMember(POP(), POP(), AS_ARRAY(POP()))) break;
-                    continue;
+                    nuc_Particle value = POP();
+                    nuc_Particle accessor = POP();
+                    nuc_ObjArr* arr = AS_ARRAY(POP());
+                    SPILL();
+                    bool set = quantise_setArrayMember(value, accessor, arr);
+                    RELOAD();
+                    if (!set) DISRUPT;
+                    NEXT;
                 } else if (IS_INSTANCE(PEEK(2))) {
-                    if (!quantise_setModelMember(POP(), POP(), AS_INSTANCE(POP()))) break;
-                    continue;
+                    nuc_Particle value = POP();
+                    nuc_Particle accessor = POP();
+                    nuc_ObjInstance* instance = AS_INSTANCE(POP());
+                    SPILL();
+                    bool set = quantise_setModelMember(value, accessor, instance);
+                    RELOAD();
+                    if (!set) DISRUPT;
+                    NEXT;
                 }
 
-                atomizer_catchableError(NUC_EXIT_TYPE, "Only arrays and models allow access to setting members with the square bracket operator.");
-                break;
+                CATCHABLE_ERROR(NUC_EXIT_TYPE, "Only arrays and models allow access to setting members with the square bracket operator.");
+                DISRUPT;
             }
 
             /**********************
              *  MODEL OPERATIONS  *
              **********************/
-            case OP_MODEL: {  // creates a new model base
-                PUSH(NUC_OBJ(model_new(READ_STRING())));
-                continue;
+            CASE(OP_MODEL): {  // creates a new model base
+                nuc_ObjString* name = READ_STRING();
+                SPILL();  // allocations may collect garbage
+                PUSH(NUC_OBJ(model_new(name)));
+                NEXT;
             }
 
             // denotes for a submodel to INHERIT all methods / default fields from the parent
-            case OP_INHERIT: {
+            CASE(OP_INHERIT): {
                 nuc_Particle base = PEEK(1);  // get the parent
 
                 // make sure it is a model
                 if (!IS_MODEL(base)) {
-                    atomizer_catchableError(NUC_EXIT_TYPE, "Parent is not a model and so cannot be derived from.");
-                    break;  // break to let error handler catch
+                    CATCHABLE_ERROR(NUC_EXIT_TYPE, "Parent is not a model and so cannot be derived from.");
+                    DISRUPT;  // break to let error handler catch
                 }
 
                 nuc_ObjModel* subModel = AS_MODEL(PEEK(0));
+                SPILL();  // growing the tables may collect garbage
+                gc_writeBarrierAll((nuc_Obj*)subModel);
                 table_addAll(&AS_MODEL(base)->methods, &subModel->methods);
                 table_addAll(&AS_MODEL(base)->defaults, &subModel->defaults);
-                POP();  // remove the subModel
-                continue;
+                subModel->initial = NULL;  // inherited defaults change the instance layout
+                top--;  // remove the subModel
+                NEXT;
             }
 
             // defines a METHOD for a model.
-            case OP_METHOD: {
-                atomizer_defineMethod(READ_STRING());
-                continue;
+            CASE(OP_METHOD): {
+                nuc_ObjString* name = READ_STRING();
+                SPILL();
+                atomizer_defineMethod(name);
+                RELOAD();
+                NEXT;
             }
 
             // defines a FIELD for a model.
-            case OP_FIELD: {
-                atomizer_defineField(READ_STRING());
-                continue;
+            CASE(OP_FIELD): {
+                nuc_ObjString* name = READ_STRING();
+                SPILL();
+                atomizer_defineField(name);
+                RELOAD();
+                NEXT;
             }
 
             // invokes a model METHOD by name
-            case OP_INVOKE: {
+            CASE(OP_INVOKE): {
                 nuc_ObjString* method = READ_STRING();
                 int argCount = READ_BYTE();
-                if (!atomizer_invoke(method, argCount)) break;  // let error handler catch
-                frame = &atomizer.frames[atomizer.frameCount - 1];
-                continue;
+                nuc_InlineCache* cache = READ_CACHE();
+                SPILL();
+                if (!atomizer_invokeCached(method, argCount, cache)) {
+                    RELOAD();
+                    DISRUPT;  // let error handler catch
+                }
+                ENTER_FRAME();
+                NEXT;
             }
 
             // invokes as base model method => the SUPER invocation
-            case OP_SUPER_INVOKE: {
+            CASE(OP_SUPER_INVOKE): {
                 nuc_ObjString* method = READ_STRING();
                 int argCount = READ_BYTE();
                 nuc_ObjModel* base = AS_MODEL(POP());
-                if (!atomizer_invokeFromModel(base, method, argCount)) break;
-                frame = &atomizer.frames[atomizer.frameCount - 1];
-                continue;
+                SPILL();
+                if (!atomizer_invokeFromModel(base, method, argCount)) {
+                    RELOAD();
+                    DISRUPT;
+                }
+                ENTER_FRAME();
+                NEXT;
             }
 
             // gets the SUPER object of a derived model.
-            case OP_GET_SUPER: {
+            CASE(OP_GET_SUPER): {
                 nuc_ObjString* name = READ_STRING();
                 nuc_ObjModel* base = AS_MODEL(POP());
-                if (!atomizer_bindMethod(base, name)) break;
-                continue;  // bound method succeeded
+                SPILL();
+                bool bound = atomizer_bindMethod(base, name);
+                RELOAD();
+                if (!bound) DISRUPT;
+                NEXT;  // bound method succeeded
             }
 
-            // Gets a property from a given model instance. This will query the instances fields, defaults,
-            // and bound methods.
-            case OP_GET_PROPERTY: {
+            // Gets a property from a given model instance. This will query the instance fields (through
+            // its shape), and then bound methods.
+            CASE(OP_GET_PROPERTY): {
                 if (!IS_INSTANCE(PEEK(0))) {
-                    atomizer_catchableError(NUC_EXIT_TYPE, "Only model instances can have properties.");
-                    break;  // and break to error handler
+                    CATCHABLE_ERROR(NUC_EXIT_TYPE, "Only model instances can have properties.");
+                    DISRUPT;  // and break to error handler
                 }
 
                 // grab the instance and property requested
                 nuc_ObjInstance* instance = AS_INSTANCE(PEEK(0));
                 nuc_ObjString* name = READ_STRING();
-
-                // check if we have a simple property (either default / field)
-                nuc_Particle value;  // temp val to save result to
-                if (table_get(&instance->model->defaults, name, &value)) {
-                    POP();
-                    PUSH(value);
-                    continue;
-                } else if (table_get(&instance->fields, name, &value)) {
-                    POP();
-                    PUSH(value);
-                    continue;
+                nuc_InlineCache* cache = READ_CACHE();
+
+                // resolve the property through the inline cache
+                uint8_t kind;
+                int index = atomizer_cachedMember(cache, instance, name, &kind);
+                if (index >= 0 && kind == IC_FIELD) {
+                    top--;
+                    PUSH(instance->slots[index]);
+                    NEXT;
                 }
 
-                // otherwise check for bound methods
-                if (!atomizer_bindMethod(instance->model, name)) {
-                    POP();  // method failed so pop
-                    PUSH(NUC_NULL);
-                    break;  // and let error handler play with it
+                // otherwise bind the resolved method
+                if (index >= 0) {
+                    SPILL();  // binding allocates
+                    nuc_ObjBoundMethod* bound = model_newBoundMethod(PEEK(0), AS_CLOSURE(instance->model->methods.entries[index].value));
+                    RELOAD();
+                    top--;
+                    PUSH(NUC_OBJ(bound));
+                    NEXT;
                 }
 
-                continue;
+                // and let the binding report the undefined property
+                SPILL();
+                atomizer_bindMethod(instance->model, name);
+                RELOAD();
+                top--;  // method failed so pop
+                PUSH(NUC_NULL);
+                DISRUPT;  // and let error handler play with it
             }
 
             // operation to handle SETTING model properties.
-            case OP_SET_BASE_PROPERTY:
-            case OP_SET_PROPERTY: {
+            CASE(OP_SET_BASE_PROPERTY):
+            CASE(OP_SET_PROPERTY): {
                 if (!IS_INSTANCE(PEEK(1))) {
-                    atomizer_catchableError(NUC_EXIT_TYPE, "Only model instances can have settable fields / methods.");
-                    break;
+                    CATCHABLE_ERROR(NUC_EXIT_TYPE, "Only model instances can have settable fields / methods.");
+                    DISRUPT;
                 }
 
-                // grab the accessor and add the value to the model
+                // grab the accessor and set the field of the instance
                 nuc_ObjString* accessor = READ_STRING();
+                nuc_InlineCache* cache = READ_CACHE();
                 nuc_ObjInstance* instance = AS_INSTANCE(PEEK(1));
-                if (!table_set(&instance->model->defaults, accessor, PEEK(0))) {
-                    table_set(&instance->fields, accessor, PEEK(0));
-                }
+                SPILL();  // transitioning shapes may collect garbage
+                atomizer_cachedSetField(cache, instance, accessor, PEEK(0));
 
                 // and complete the following if NOT setting a base property
-                if (*frame->ip == OP_SET_PROPERTY) {
+                if (inst == OP_SET_PROPERTY) {
                     nuc_Particle value = POP();
-                    POP();
+                    top--;
                     PUSH(value);
                 }
-                continue;
+                NEXT;
+            }
+
+            /**********************
+             *  FUSED OPERATIONS  *
+             **********************/
+
+            // GET_LOCAL, CONSTANT, LESS, JUMP_IF_FALSE. Leaves the comparison on the stack like the
+            // original JUMP_IF_FALSE does. The constant is always numeric (checked when fusing).
+            CASE(OP_LOCAL_LT_CONST_JUMP): {
+                nuc_Particle a = READ_LOCAL();
+                nuc_Particle b = READ_CONSTANT();
+                uint32_t offset = READ_ADDR();
+                bool res;
+                if (IS_NUMBER(a)) {
+                    res = AS_NUMBER(a) < AS_NUMBER(b);
+                } else {
+                    SPILL();
+                    res = quantise_isLess(a, b);
+                    RELOAD();
+                    if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) DISRUPT;
+                }
+                PUSH(NUC_BOOL(res));
+                if (!res) ip += offset;
+                NEXT;
+            }
+
+            // GET_LOCAL, GET_LOCAL, ADD. Falls back to concatenation for non-numerics.
+            CASE(OP_ADD_LOCALS): {
+                nuc_Particle a = READ_LOCAL();
+                nuc_Particle b = READ_LOCAL();
+                if (IS_NUMBER(a) && IS_NUMBER(b)) {
+                    PUSH(NUC_NUM(AS_NUMBER(a) + AS_NUMBER(b)));
+                    NEXT;
+                }
+
+                PUSH(a);
+                PUSH(b);
+                SPILL();
+                bool concatenated = quantise_concat();
+                RELOAD();
+                if (concatenated) NEXT;
+                DISRUPT;
+            }
+
+            // GET_LOCAL, CONSTANT, SUB (constant is always numeric).
+            CASE(OP_SUB_LOCAL_CONST): {
+                nuc_Particle a = READ_LOCAL();
+                nuc_Particle b = READ_CONSTANT();
+                if (IS_NUMBER(a)) {
+                    PUSH(NUC_NUM(AS_NUMBER(a) - AS_NUMBER(b)));
+                    NEXT;
+                }
+
+                PUSH(a);
+                PUSH(b);
+                EXPECT_NUMERICS(-);
+                NEXT;
+            }
+
+            // GET_LOCAL, CONSTANT, SUB, CALL (constant is always numeric).
+            CASE(OP_SUB_LOCAL_CONST_CALL): {
+                nuc_Particle a = READ_LOCAL();
+                nuc_Particle b = READ_CONSTANT();
+                int argCount = READ_BYTE();
+                if (!IS_NUMBER(a)) {
+                    PUSH(a);
+                    PUSH(b);
+                    EXPECT_NUMERICS(-);
+                }
+
+                PUSH(NUC_NUM(AS_NUMBER(a) - AS_NUMBER(b)));
+                SPILL();
+                if (!atomizer_callValue(PEEK(argCount), argCount)) {
+                    RELOAD();
+                    DISRUPT;
+                }
+                ENTER_FRAME();
+                NEXT;
             }
 
             /** Default Case - Unknown Instruction */
-            default:
+            CASE_UNKNOWN:
+                SPILL();
                 atomizer_runtimeError(NUC_EXIT_INTERNAL, "Encountered an unknown operation \x1b[33m%d\x1b[0m.", inst);
                 return;  // want to IMMEDIATELY return out
         }
 
         // now want to check some things for our event loop
+        DISRUPTION_HANDLER
+        SPILL();  // disruptions are handled on the frame / atomizer state
         if (!NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) {
             continue;  // no errors, immediately continue
+        } else if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTION_CATCHABLE) && catchBlockIP == 0x00) {
+            // the catch was set up by an enclosing loop, so hand the disruption back to it
+            if (baseFrame > 1) quantise_unwind(baseFrame);
+            return;
         } else if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTION_CATCHABLE)) {
             // Error that fell through IS catchable, so we can FIX catch conditions here. Start
             // by JUMPING to the catch block IP.
-            frame->ip = (uint8_t*)catchBlockIP;
+            ip = (uint8_t*)catchBlockIP;
             catchBlockIP = 0x00;                              // reset the catch block IP
             NUC_UNSET_AFLAG(NUC_AFLAG_DISRUPTION_CATCHABLE);  // reset the catchable mode
             NUC_UNSET_AFLAG(NUC_AFLAG_DISRUPTED);             // and the disruption flag
@@ -705,8 +1000,54 @@ void atomizer_quantise() {
 #undef READ_ADDR
 #undef READ_CONSTANT
 #undef READ_STRING
+#undef READ_CACHE
+#undef READ_LOCAL
+#undef SPILL
+#undef RELOAD
+#undef LOAD_FRAME
+#undef ENTER_FRAME
+#undef CATCHABLE_ERROR
 #undef EXPECT_NUMERICS
 #undef NUMERIC_BIN_OP
 #undef BITWISE_BIN_OP
+#undef CASE_OPERATOR
+#undef QUANTISE_TRACE
+#undef DISPATCH_LOOP
+#undef DISPATCH_TABLE
+#undef DISRUPTION_HANDLER
+#undef CASE
+#undef CASE_UNKNOWN
+#undef NEXT
+#undef DISRUPT
+#ifdef NUC_THREADED_DISPATCH
+    #undef DISPATCH
+    #undef OP_LABEL
+#endif
+
+// and restore the atomizer stack macros
+#undef PUSH
+#undef POP
+#undef PEEK
+#define PUSH(val) atomizer_push(val)
+#define POP() atomizer_pop()
+#define PEEK(dist) atomizer_peek(dist)
+
+/***************************
+ *  REGISTER QUANTISATION  *
+ ***************************/
+
+#include "registers.h"  // register tier loop
+
+/**
+ * Coordinates the MAIN virtual machine loop for Nucleus atomization. Runs the current
+ * call frame on the loop matching the execution tier of its reaction.
+ */
+void atomizer_quantise() {
+    if (atomizer.frames[atomizer.frameCount - 1].closure->reaction->tier == NUC_TIER_REGISTER) {
+        atomizer_quantiseRegisters();
+    } else {
+        atomizer_quantiseStack();
+    }
+}
 
 #endif
\ No newline at end of file
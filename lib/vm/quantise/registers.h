@@ -0,0 +1,406 @@
+#ifndef NUC_QUANTISE_REGISTERS_H
+#define NUC_QUANTISE_REGISTERS_H
+
+// Nucleus Headers
+#include "../../bytecode/registers.h"
+#include "../global.h"
+
+/*********************
+ *  INTERNAL MACROS  *
+ *********************/
+
+/** Saves the register instruction pointer to the current FRAME (before calls / disruptions). */
+#define REG_SAVE() frame->rip = ip
+
+/** Loads the locals of the current FRAME. */
+#define REG_LOAD()                                            \
+    do {                                                      \
+        frame = &atomizer.frames[atomizer.frameCount - 1];    \
+        R = frame->slots;                                     \
+        ip = frame->rip;                                      \
+        K = frame->closure->reaction->chunk.constants.values; \
+    } while (0)
+
+/** Reads a jump offset word. */
+#define REG_OFFSET() ((int32_t)*ip++)
+
+/** Raises a catchable disruption and exits to the disruption handler. */
+#define REG_DISRUPT(code, ...)                         \
+    {                                                  \
+        REG_SAVE();                                    \
+        atomizer_catchableError(code, __VA_ARGS__);    \
+        goto disrupted;                                \
+    }
+
+/**
+ * Coordinates a numeric binary operation between R[B] and a given right operand.
+ * @param rhs                   Right operand.
+ * @param type                  Operand cast type.
+ * @param op                    Operator to use.
+ */
+#define REG_BIN_OP(rhs, type, op)                                                               \
+    {                                                                                           \
+        nuc_Particle left = R[NUC_REG_B(word)], right = (rhs);                                  \
+        if (!IS_NUMBER(left) || !IS_NUMBER(right))                                              \
+            REG_DISRUPT(NUC_EXIT_TYPE, "The \"" #op "\" operator expected numeric operands."); \
+        R[NUC_REG_A(word)] = NUC_NUM((type)AS_NUMBER(left) op (type)AS_NUMBER(right));          \
+        continue;                                                                               \
+    }
+
+/**
+ * Runs an operand pair through a STACK operation helper (ie: concatenation), storing the result in R[A].
+ * @param rhs                   Right operand.
+ * @param method                Stack operation to complete.
+ */
+#define REG_STACK_OP(rhs, method)                     \
+    {                                                 \
+        REG_SAVE();                                   \
+        PUSH(R[NUC_REG_B(word)]);                     \
+        PUSH(rhs);                                    \
+        method;                                       \
+        if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) goto disrupted; \
+        R[NUC_REG_A(word)] = POP();                   \
+        continue;                                     \
+    }
+
+/**
+ * Compares lhs < rhs into R[A].
+ * @param lhs                   Left operand.
+ * @param rhs                   Right operand.
+ */
+#define REG_COMPARE(lhs, rhs)                                                                      \
+    nuc_Particle left = (lhs), right = (rhs);                                                      \
+    bool res;                                                                                      \
+    if (IS_NUMBER(left) && IS_NUMBER(right)) {                                                     \
+        res = AS_NUMBER(left) < AS_NUMBER(right);                                                  \
+    } else {                                                                                       \
+        REG_SAVE();                                                                                \
+        res = quantise_isLess(left, right);                                                        \
+        if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) goto disrupted;                                  \
+    }                                                                                              \
+    R[NUC_REG_A(word)] = NUC_BOOL(res)
+
+/*********************
+ *  REGISTER HELPERS  *
+ *********************/
+
+/**
+ * Restores the register window of a frame after a call returned into it (every register above the
+ * result is cleared, keeping the GC from seeing stale values).
+ * @param frame                     Frame to restore.
+ */
+static inline void quantise_restoreWindow(nuc_CallFrame* frame) {
+    nuc_Particle* end = frame->slots + frame->closure->reaction->regs.frameSize;
+    while (atomizer.top < end) *atomizer.top++ = NUC_NULL;
+}
+
+/***************************
+ *  REGISTER QUANTISATION  *
+ ***************************/
+
+/**
+ * Coordinates the REGISTER virtual machine loop. Runs register tier frames until the frame that
+ * entered the loop returns. Stack tier reactions called from here run in a nested stack loop.
+ */
+static void atomizer_quantiseRegisters() {
+    int baseFrame = atomizer.frameCount;  // frame that entered the loop
+
+    // cache the current frame state in locals
+    nuc_CallFrame* frame;
+    nuc_Particle* R;
+    uint32_t* ip;
+    nuc_Particle* K;
+    REG_LOAD();
+
+    for (;;) {
+        uint32_t word = *ip++;
+        switch (NUC_REG_OP(word)) {
+            /** Loads */
+            case ROP_MOVE:
+                R[NUC_REG_A(word)] = R[NUC_REG_B(word)];
+                continue;
+            case ROP_LOADK:
+                R[NUC_REG_A(word)] = K[NUC_REG_BX(word)];
+                continue;
+            case ROP_LOADNULL:
+                R[NUC_REG_A(word)] = NUC_NULL;
+                continue;
+            case ROP_LOADTRUE:
+                R[NUC_REG_A(word)] = NUC_TRUE;
+                continue;
+            case ROP_LOADFALSE:
+                R[NUC_REG_A(word)] = NUC_FALSE;
+                continue;
+
+            /** Math Operations */
+            case ROP_ADD: {
+                nuc_Particle a = R[NUC_REG_B(word)], b = R[NUC_REG_C(word)];
+                if (IS_NUMBER(a) && IS_NUMBER(b)) {
+                    R[NUC_REG_A(word)] = NUC_NUM(AS_NUMBER(a) + AS_NUMBER(b));
+                    continue;
+                }
+                REG_STACK_OP(b, quantise_concat());
+            }
+            case ROP_ADDK: {
+                nuc_Particle a = R[NUC_REG_B(word)], b = K[NUC_REG_C(word)];
+                if (IS_NUMBER(a) && IS_NUMBER(b)) {
+                    R[NUC_REG_A(word)] = NUC_NUM(AS_NUMBER(a) + AS_NUMBER(b));
+                    continue;
+                }
+                REG_STACK_OP(b, quantise_concat());
+            }
+            case ROP_MUL:
+            case ROP_MULK: {
+                nuc_Particle a = R[NUC_REG_B(word)];
+                nuc_Particle b = NUC_REG_OP(word) == ROP_MUL ? R[NUC_REG_C(word)] : K[NUC_REG_C(word)];
+                if (IS_STRING(b) && IS_NUMBER(a)) REG_STACK_OP(b, quantise_repeat(NUC_REPEAT_SN));
+                if (IS_NUMBER(b) && IS_STRING(a)) REG_STACK_OP(b, quantise_repeat(NUC_REPEAT_NS));
+                REG_BIN_OP(b, double, *);
+            }
+            case ROP_SUB: REG_BIN_OP(R[NUC_REG_C(word)], double, -);
+            case ROP_SUBK: REG_BIN_OP(K[NUC_REG_C(word)], double, -);
+            case ROP_DIV: REG_BIN_OP(R[NUC_REG_C(word)], double, /);
+            case ROP_DIVK: REG_BIN_OP(K[NUC_REG_C(word)], double, /);
+            case ROP_XOR: REG_BIN_OP(R[NUC_REG_C(word)], int32_t, ^);
+            case ROP_BITW_OR: REG_BIN_OP(R[NUC_REG_C(word)], int32_t, |);
+            case ROP_BITW_AND: REG_BIN_OP(R[NUC_REG_C(word)], int32_t, &);
+            case ROP_ROL: REG_BIN_OP(R[NUC_REG_C(word)], int32_t, <<);
+            case ROP_ROR: REG_BIN_OP(R[NUC_REG_C(word)], int32_t, >>);
+            case ROP_MOD: {
+                nuc_Particle a = R[NUC_REG_B(word)], b = R[NUC_REG_C(word)];
+                if (!IS_NUMBER(a) || !IS_NUMBER(b)) REG_DISRUPT(NUC_EXIT_TYPE, "The \"%%\" operator expected numeric operands.");
+                R[NUC_REG_A(word)] = NUC_NUM(fmod(AS_NUMBER(a), AS_NUMBER(b)));
+                continue;
+            }
+            case ROP_POW: {
+                nuc_Particle a = R[NUC_REG_B(word)], b = R[NUC_REG_C(word)];
+                if (!IS_NUMBER(a) || !IS_NUMBER(b)) REG_DISRUPT(NUC_EXIT_TYPE, "The \"**\" operator expected numeric operands.");
+                R[NUC_REG_A(word)] = NUC_NUM(pow(AS_NUMBER(a), AS_NUMBER(b)));
+                continue;
+            }
+            case ROP_NEGATE: {
+                nuc_Particle a = R[NUC_REG_B(word)];
+                if (!IS_NUMBER(a)) REG_DISRUPT(NUC_EXIT_TYPE, "The \"-\" unary operator expects a numeric operand.");
+                R[NUC_REG_A(word)] = NUC_NUM(-AS_NUMBER(a));
+                continue;
+            }
+            case ROP_BITW_NOT: {
+                nuc_Particle a = R[NUC_REG_B(word)];
+                if (!IS_NUMBER(a)) REG_DISRUPT(NUC_EXIT_TYPE, "The \"~\" unary operator expects a numeric operand.");
+                R[NUC_REG_A(word)] = NUC_NUM(~(int32_t)AS_NUMBER(a));
+                continue;
+            }
+            case ROP_NOT:
+                R[NUC_REG_A(word)] = NUC_BOOL(quantise_isFalsey(R[NUC_REG_B(word)]));
+                continue;
+
+            /** Comparisons */
+            case ROP_EQUAL:
+                R[NUC_REG_A(word)] = NUC_BOOL(quantise_isEqual(R[NUC_REG_B(word)], R[NUC_REG_C(word)]));
+                continue;
+            case ROP_LESS: {
+                REG_COMPARE(R[NUC_REG_B(word)], R[NUC_REG_C(word)]);
+                continue;
+            }
+            case ROP_LESSK: {
+                REG_COMPARE(R[NUC_REG_B(word)], K[NUC_REG_C(word)]);
+                continue;
+            }
+            case ROP_GREATER: {
+                REG_COMPARE(R[NUC_REG_C(word)], R[NUC_REG_B(word)]);
+                continue;
+            }
+
+            /** Control Operations */
+            case ROP_JUMP: {
+                int32_t offset = REG_OFFSET();
+                ip += offset;
+                continue;
+            }
+            case ROP_JUMP_IF_FALSE: {
+                int32_t offset = REG_OFFSET();
+                if (quantise_isFalsey(R[NUC_REG_A(word)])) ip += offset;
+                continue;
+            }
+            case ROP_LESS_JUMP: {
+                REG_COMPARE(R[NUC_REG_B(word)], R[NUC_REG_C(word)]);
+                int32_t offset = REG_OFFSET();
+                if (!res) ip += offset;
+                continue;
+            }
+            case ROP_LESSK_JUMP: {
+                REG_COMPARE(R[NUC_REG_B(word)], K[NUC_REG_C(word)]);
+                int32_t offset = REG_OFFSET();
+                if (!res) ip += offset;
+                continue;
+            }
+            case ROP_FOR_NUM_PREP: {
+                int32_t offset = REG_OFFSET();
+                if (quantise_isEqual(R[NUC_REG_A(word)], R[NUC_REG_B(word)])) ip += offset;
+                continue;
+            }
+            case ROP_FOR_NUM_LOOP: {
+                nuc_Particle variable = R[NUC_REG_A(word)], limit = R[NUC_REG_B(word)];
+                double step = AS_NUMBER(R[NUC_REG_C(word)]);
+                int32_t offset = REG_OFFSET();
+                if (IS_NUMBER(variable) && IS_NUMBER(limit)) {
+                    double next = AS_NUMBER(variable) + step;
+                    R[NUC_REG_A(word)] = NUC_NUM(next);
+                    if (next != AS_NUMBER(limit)) ip += offset;
+                    continue;
+                }
+
+                // otherwise step as the generic addition would
+                if (IS_NUMBER(variable)) {
+                    variable = NUC_NUM(AS_NUMBER(variable) + step);
+                } else {
+                    REG_SAVE();
+                    PUSH(variable);
+                    PUSH(NUC_NUM(step));
+                    quantise_concat();
+                    if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) goto disrupted;
+                    variable = POP();
+                }
+                R[NUC_REG_A(word)] = variable;
+                if (!quantise_isEqual(variable, limit)) ip += offset;
+                continue;
+            }
+
+            /** Variable Operations */
+            case ROP_DEFINE_GLOBAL:
+                atomizer.globalSlots.values[NUC_REG_BX(word)] = R[NUC_REG_A(word)];
+                continue;
+            case ROP_GET_GLOBAL: {
+                nuc_Particle value = atomizer.globalSlots.values[NUC_REG_BX(word)];
+                if (IS_UNDEFINED(value))
+                    REG_DISRUPT(NUC_EXIT_REF, "Undefined variable reference to \"%s\".", atomizer_globalName(NUC_REG_BX(word))->chars);
+                R[NUC_REG_A(word)] = value;
+                continue;
+            }
+            case ROP_SET_GLOBAL: {
+                if (IS_UNDEFINED(atomizer.globalSlots.values[NUC_REG_BX(word)]))
+                    REG_DISRUPT(NUC_EXIT_REF, "Tried to set an undefined variable \"%s\".", atomizer_globalName(NUC_REG_BX(word))->chars);
+                atomizer.globalSlots.values[NUC_REG_BX(word)] = R[NUC_REG_A(word)];
+                continue;
+            }
+            case ROP_GET_UPVALUE:
+                R[NUC_REG_A(word)] = *frame->closure->upvalues[NUC_REG_BX(word)]->location;
+                continue;
+            case ROP_SET_UPVALUE: {
+                nuc_ObjUpvalue* upvalue = frame->closure->upvalues[NUC_REG_BX(word)];
+                gc_writeBarrier((nuc_Obj*)upvalue, R[NUC_REG_A(word)]);  // (if closed)
+                *upvalue->location = R[NUC_REG_A(word)];
+                continue;
+            }
+            case ROP_CLOSE_UPVALUE:
+                nuc_upvalue_closeAll(R + NUC_REG_A(word));
+                continue;
+            case ROP_GET_NATIVE: {
+                REG_SAVE();  // boxing the native may collect garbage
+                nuc_Particle native = atomizer_boxNative(NUC_REG_BX(word));
+                R[NUC_REG_A(word)] = native;
+                continue;
+            }
+
+            /** Reaction Operations */
+            case ROP_CALL: {
+                nuc_Particle callee = R[NUC_REG_A(word)];
+                int frames = atomizer.frameCount;
+                REG_SAVE();
+                atomizer.top = R + NUC_REG_A(word) + NUC_REG_B(word) + 1;
+
+                // register reactions are entered directly
+                if (IS_CLOSURE(callee) && AS_CLOSURE(callee)->reaction->tier == NUC_TIER_REGISTER) {
+                    if (!atomizer_call(AS_CLOSURE(callee), NUC_REG_B(word))) goto disrupted;
+                    REG_LOAD();
+                    continue;
+                }
+
+                if (!atomizer_callValue(callee, NUC_REG_B(word))) goto disrupted;
+
+                // register reactions continue in this loop, stack reactions run to completion
+                if (atomizer.frameCount != frames) {
+                    if (atomizer.frames[atomizer.frameCount - 1].closure->reaction->tier == NUC_TIER_REGISTER) {
+                        REG_LOAD();
+                        continue;
+                    }
+                    atomizer_quantiseStack();
+                    if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTED)) goto disrupted;
+                }
+
+                quantise_restoreWindow(frame);
+                continue;
+            }
+            case ROP_CALL_NATIVE_NUM:
+                if (atomizer_callNativeFast(atomizer_nativeFastCall(NUC_REG_C(word)), NUC_REG_B(word), R + NUC_REG_A(word))) continue;
+                // fall through - mistyped arguments take the generic path
+            case ROP_CALL_NATIVE: {
+                REG_SAVE();
+                atomizer.top = R + NUC_REG_A(word) + NUC_REG_B(word);
+                if (!atomizer_callNative(atomizer_nativeReaction(NUC_REG_C(word)), NUC_REG_B(word))) goto disrupted;
+                quantise_restoreWindow(frame);
+                continue;
+            }
+            case ROP_CLOSURE: {
+                nuc_ObjClosure* closure = closure_new(AS_REACTION(K[NUC_REG_BX(word)]));
+                R[NUC_REG_A(word)] = NUC_OBJ(closure);
+
+                // now want to capture upvalues for the closure
+                for (int i = 0; i < closure->uvCount; i++) {
+                    uint32_t capture = *ip++;
+                    uint16_t index = (uint16_t)(capture & 0xFFFF);
+                    closure->upvalues[i] = (capture >> 16) ? upvalue_capture(R + index) : frame->closure->upvalues[index];
+                    gc_writeBarrier((nuc_Obj*)closure, NUC_OBJ(closure->upvalues[i]));  // captures may collect garbage
+                }
+                continue;
+            }
+            case ROP_ARRAY: {
+                nuc_ObjArr* arr = objArr_new(ARR_BASIC);
+                PUSH(NUC_OBJ(arr));  // keep the array reachable whilst growing
+                for (int i = 0; i < NUC_REG_BX(word); i++) objArr_push(arr, R[NUC_REG_A(word) + i]);
+                R[NUC_REG_A(word)] = POP();
+                continue;
+            }
+            case ROP_RETURN: {
+                nuc_Particle res = R[NUC_REG_A(word)];
+                nuc_upvalue_closeAll(R);  // close the frames upvalues
+                atomizer.frameCount--;    // and decrement the frame count
+                atomizer.top = R;
+
+                // no more frames, or returning out of this loop
+                if (atomizer.frameCount == 0) return;
+                PUSH(res);
+                if (atomizer.frameCount < baseFrame) return;
+
+                // otherwise continue with the calling register frame
+                REG_LOAD();
+                quantise_restoreWindow(frame);
+                continue;
+            }
+
+            default:
+                REG_SAVE();
+                atomizer_runtimeError(NUC_EXIT_INTERNAL, "Encountered an unknown register operation \x1b[33m%d\x1b[0m.", NUC_REG_OP(word));
+                return;
+        }
+
+    disrupted:
+        // catchable disruptions are handed back to the stack loop that set up the catch
+        if (NUC_CHECK_AFLAG(NUC_AFLAG_DISRUPTION_CATCHABLE)) quantise_unwind(baseFrame);
+        return;
+    }
+}
+
+/*********************
+ *  MACRO UNDEFINES  *
+ *********************/
+
+#undef REG_SAVE
+#undef REG_LOAD
+#undef REG_OFFSET
+#undef REG_DISRUPT
+#undef REG_BIN_OP
+#undef REG_STACK_OP
+#undef REG_COMPARE
+
+#endif
@@ -3,30 +3,135 @@
 
 // Nucleus Headers
 #include "../stdlib/natives.h"
+#include "../utils/hash.h"
+#include "core/globals.h"
+#include "disruptions/immediate.h"
+
+/*************************
+ *  NATIVE LOOKUP TABLE  *
+ *************************/
+
+// Natives are found through a perfect hash: a seed is chosen once so that every native name lands
+// in its own bucket, so a lookup is a single probe followed by one exact string comparison.
+#define NUC_NATIVE_TABLE_BITS 8
+#define NUC_NATIVE_TABLE_SIZE (1 << NUC_NATIVE_TABLE_BITS)  // must comfortably exceed the native count
+
+/**
+ * Retrieves the bucket of a native name hash for a given seed.
+ * @param hash                          Name hash (as by `hash_generic`).
+ * @param seed                          Table seed.
+ */
+#define NUC_NATIVE_BUCKET(hash, seed) ((((hash) ^ (seed)) * 0x9E3779B1u) >> (32 - NUC_NATIVE_TABLE_BITS))
+
+static int16_t nuc_nativeTable[NUC_NATIVE_TABLE_SIZE];  // bucket => native index (-1 if empty)
+static uint32_t nuc_nativeSeed = 0;                      // seed giving a collision free table
+static bool nuc_nativeTableBuilt = false;
+
+/** Builds the perfect hash table of the available natives (only needs to occur once). */
+static void nuc_buildNativeTable() {
+    if (nuc_nativeTableBuilt) return;
+
+    // try seeds until every native lands in a bucket of its own
+    for (uint32_t seed = 0; seed < UINT16_COUNT; seed++) {
+        for (int i = 0; i < NUC_NATIVE_TABLE_SIZE; i++) nuc_nativeTable[i] = -1;
+
+        bool perfect = true;
+        for (int i = 0; i < NUC_NATIVE_REACTIONS_LEN && perfect; i++) {
+            const char* name = nuc_nativeReactionRefs[i].name;
+            uint32_t bucket = NUC_NATIVE_BUCKET(hash_generic(name, (int)strlen(name)), seed);
+            if (nuc_nativeTable[bucket] != -1) perfect = false;
+            nuc_nativeTable[bucket] = (int16_t)i;
+        }
+
+        if (perfect) {
+            nuc_nativeSeed = seed;
+            nuc_nativeTableBuilt = true;
+            return;
+        }
+    }
+
+    nuc_immediateExit(NUC_EXIT_INTERNAL, "Could not build the native lookup table.\n");
+}
+
+/**
+ * Finds the index of a native by name. Unlike a prefix comparison, only exact names match.
+ * @param chars                         Name of the native.
+ * @param length                        Length of the name.
+ * @returns                             Native index, or -1 if there is no such native.
+ */
+static int atomizer_findNative(const char* chars, int length) {
+    int index = nuc_nativeTable[NUC_NATIVE_BUCKET(hash_generic(chars, length), nuc_nativeSeed)];
+    if (index == -1) return -1;
+
+    // the bucket may belong to another name entirely
+    const char* name = nuc_nativeReactionRefs[index].name;
+    if (strlen(name) != (size_t)length || memcmp(name, chars, length) != 0) return -1;
+    return index;
+}
+
+/**
+ * Retrieves the reaction of a native.
+ * @param index                         Native index.
+ */
+static inline nuc_NativeReaction atomizer_nativeReaction(int index) {
+    return nuc_nativeReactionRefs[index].native;
+}
+
+/**
+ * Retrieves the typed entry points of a native.
+ * @param index                         Native index.
+ */
+static inline const nuc_NativeFastCall* atomizer_nativeFastCall(int index) {
+    return &nuc_nativeReactionRefs[index].fast;
+}
+
+/**
+ * Determines if a native has a typed entry point for a given arity.
+ * @param index                         Native index.
+ * @param argCount                      Arguments given to the native.
+ */
+static bool atomizer_hasNativeFastCall(int index, int argCount) {
+    const nuc_NativeFastCall* fast = atomizer_nativeFastCall(index);
+    switch (argCount) {
+        case 1: return fast->num1 != NULL;
+        case 2: return fast->num2 != NULL;
+        case 3: return fast->num3 != NULL;
+        default: return false;
+    }
+}
+
+#if defined(NUC_DEBUG_BYTECODE) || defined(NUC_DEBUG_CACHES)  // (only the disassembler displays natives)
+/**
+ * Retrieves the name of a native (for debug display).
+ * @param index                         Native index.
+ */
+static const char* atomizer_nativeName(int index) {
+    return nuc_nativeReactionRefs[index].name;
+}
+#endif
 
 /***********************
  *  NATIVE RESOLUTION  *
  ***********************/
 
+/** Prepares the natives of the atomizer. Natives are only boxed into objects once referenced. */
+static inline void atomizer_initNatives() {
+    nuc_buildNativeTable();
+    particleArr_init(&atomizer.natives);
+    for (int i = 0; i < NUC_NATIVE_REACTIONS_LEN; i++) particleArr_write(&atomizer.natives, NUC_NULL);
+}
+
 /**
- * Resolves and loads a native to the available hash table. Although this will be slow on the
- * first call, it means quicker start times for atomization and less memory use when not
- * entirely using the whole native library.
- * @param name                          Name of native to load.
+ * Retrieves a native as a particle (for natives used as values rather than called directly). The
+ * native object is only allocated on first use, meaning quicker start times for atomization and
+ * less memory use when not entirely using the whole native library.
+ * @param index                         Native index.
  */
-static inline nuc_Particle atomizer_resolveNative(nuc_ObjString* name) {
-    nuc_Particle value;
-    for (int i = 0; i < NUC_NATIVE_REACTIONS_LEN; i++) {
-        if (memcmp(name->chars, nuc_nativeReactionRefs[i].name, name->length) != 0) continue;
-        value = NUC_OBJ(native_new(nuc_nativeReactionRefs[i].native));
-        table_set(&atomizer.natives, name, value);  // DON'T need to worry about garbage collection here!
-                                                    // This is becuase the nuc_ObjString* is already ON the stack
-        return value;
+static inline nuc_Particle atomizer_boxNative(int index) {
+    if (IS_NULL(atomizer.natives.values[index])) {
+        atomizer.natives.values[index] = NUC_OBJ(native_new(nuc_nativeReactionRefs[index].native));
     }
-
-    // in case of an error
-    atomizer_catchableError(NUC_EXIT_REF, "Unknown native \"%s\".", name->chars);
-    return NUC_NULL;
+    return atomizer.natives.values[index];
 }
 
 /*******************
@@ -36,13 +141,13 @@ static inline nuc_Particle atomizer_resolveNative(nuc_ObjString* name) {
 /** Defines the MODEL LITERAL that is used to create anonymous models using the "{}" syntax. */
 static inline void nuc_defineModelLiteral() {
     nuc_Particle model = NUC_OBJ(model_new(atomizer.modelLiteral));  // generate the model
-    table_set(&atomizer.globals, atomizer.modelLiteral, model);
+    atomizer_defineGlobal(atomizer.modelLiteral, model);
 }
 
 /** Defines the DISRUPTION MODEL that is used for errors. */
 static inline void nuc_defineDisruptionModel() {
     nuc_Particle model = NUC_OBJ(model_new(atomizer.disruption));
-    table_set(&atomizer.globals, atomizer.disruption, model);
+    atomizer_defineGlobal(atomizer.disruption, model);
 }
 
 /*******************
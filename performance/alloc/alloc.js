@@ -0,0 +1,48 @@
+/** JavaScript pair of the allocation loop */
+class Pair {
+    constructor() {
+        this.a = 0;
+        this.b = 0;
+    }
+
+    sum() {
+        return this.a + this.b;
+    }
+}
+
+/** JavaScript allocation loop */
+const allocate = iters => {
+    let s = 0;
+    for (let i = 0; i < iters; i++) {
+        const pair = new Pair();
+        const sum = pair.sum.bind(pair);
+        const add = x => x + i;
+        const label = 'p' + i;
+        s = s + sum() + add(1) + label.length * 0;
+    }
+    return s;
+}
+
+/** JavaScript Benchaming method */
+const bench = iters => {
+    const ITERATIONS = 100000;
+    let min = Infinity;
+    let sum = 0n;
+
+    for (let i = 0; i < iters; i++) {
+        const t_start = process.hrtime.bigint();
+        allocate(ITERATIONS);
+        const t_duration = (process.hrtime.bigint() - t_start) / 1000n;
+
+        sum += t_duration;
+        if (t_duration < min) min = t_duration;
+    }
+
+    console.log(`Average: ${sum / BigInt(iters)}us`);
+    console.log(`Min: ${min}us`);
+    console.log(`Per Iteration: ${Number(min) * 1000 / ITERATIONS}ns`);
+}
+
+console.log('\n=> JavaScript');
+bench(10);
+console.log();
@@ -0,0 +1,52 @@
+import time
+
+
+# Python pair of the allocation loop
+class Pair:
+    def __init__(self):
+        self.a = 0
+        self.b = 0
+
+    def sum(self):
+        return self.a + self.b
+
+
+# Python Implementation of the allocation loop
+def allocate(iters):
+    s = 0
+    for i in range(0, iters):
+        pair = Pair()
+        sum = pair.sum
+
+        def add(x):
+            return x + i
+
+        label = "p" + str(i)
+        s = s + sum() + add(1)
+    return s
+
+
+# Python Benchmarker
+def bench(iters):
+    ITERATIONS = 100000
+    min = float("inf")
+    sum = 0
+
+    for i in range(0, iters):
+        start = time.time()
+        allocate(ITERATIONS)
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Per Iteration: " + str(min * 1000000000 / ITERATIONS) + "ns")
+    pass
+
+
+print("\n=> Python3")
+bench(10)
+print()
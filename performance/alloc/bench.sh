@@ -0,0 +1,7 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+python3 $SCRIPT_DIR/alloc.py
+node $SCRIPT_DIR/alloc.js
+./nucleus.exe $SCRIPT_DIR/alloc.nuc
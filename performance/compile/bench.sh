@@ -0,0 +1,34 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+python3 $SCRIPT_DIR/compile.py
+node $SCRIPT_DIR/compile.js
+
+# Nucleus cannot compile source at runtime, so the generated script (declarations only) is timed
+# as a whole, which is dominated by compiling it
+SOURCE=$(mktemp --suffix=.nuc)
+python3 $SCRIPT_DIR/compile.py $SOURCE
+
+# each run is timed without a bytecode image (compiling the source), then with the image cached
+# beside the source by the first run
+for MODE in "Compiled" "Cached"; do
+    echo "=> Nucleus ($MODE)"
+    MIN=0
+    SUM=0
+    for i in $(seq 1 10); do
+        if [ "$MODE" = "Compiled" ]; then rm -f ${SOURCE}b; fi
+        START=$(date +%s%N)
+        ./nucleus.exe $SOURCE
+        DURATION=$(( ($(date +%s%N) - START) / 1000 ))
+
+        SUM=$(( SUM + DURATION ))
+        if [ $MIN -eq 0 ] || [ $DURATION -lt $MIN ]; then MIN=$DURATION; fi
+    done
+
+    echo "Average: $(( SUM / 10 ))us"
+    echo "Min: ${MIN}us"
+    echo "Per Reaction: $(( MIN / 2000 ))us"
+    echo
+done
+rm -f $SOURCE ${SOURCE}b
@@ -0,0 +1,46 @@
+/** Generates a JavaScript source of many small functions (nested closures with a handful of locals) */
+const REACTIONS = 2000;
+const LOCALS = 16;
+
+const source = () => {
+    const lines = [];
+    for (let r = 0; r < REACTIONS; r++) {
+        lines.push(`function r${r}(a, b) {`);
+        lines.push(`    let x0 = a + b;`);
+        for (let i = 1; i < LOCALS; i++) lines.push(`    let x${i} = x${i - 1} * b + ${i};`);
+        lines.push(`    function inner(c) {`);
+        lines.push(`        let y = c + x${LOCALS - 1};`);
+        lines.push(`        function leaf(d) { return d + y + x0; }`);
+        lines.push(`        return leaf;`);
+        lines.push(`    }`);
+        lines.push(`    if (x3 < x4) { x5 = x6; } else { x7 = x8; }`);
+        lines.push(`    while (x1 < 10) { x1 = x1 + 1; }`);
+        lines.push(`    return inner;`);
+        lines.push(`}`);
+    }
+    return lines.join('\n');
+}
+
+/** JavaScript Benchaming method (function bodies are compiled lazily, so this is mostly parsing) */
+const bench = iters => {
+    const code = source();
+    let min = Infinity;
+    let sum = 0n;
+
+    for (let i = 0; i < iters; i++) {
+        const t_start = process.hrtime.bigint();
+        new Function(code);
+        const t_duration = (process.hrtime.bigint() - t_start) / 1000n;
+
+        sum += t_duration;
+        if (t_duration < min) min = t_duration;
+    }
+
+    console.log(`Average: ${sum / BigInt(iters)}us`);
+    console.log(`Min: ${min}us`);
+    console.log(`Per Reaction: ${Number(min) / REACTIONS}us`);
+}
+
+console.log('\n=> JavaScript');
+bench(10);
+console.log();
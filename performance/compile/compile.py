@@ -0,0 +1,71 @@
+import sys
+import time
+
+# Generates a source of many small reactions (nested closures with a handful of locals each)
+REACTIONS = 2000
+LOCALS = 16
+
+
+def source(language):
+    lines = []
+    for r in range(0, REACTIONS):
+        if language == "nucleus":
+            lines.append("reaction r" + str(r) + "(a, b) {")
+            lines.append("    let x0 = a + b;")
+            for i in range(1, LOCALS):
+                lines.append("    let x" + str(i) + " = x" + str(i - 1) + " * b + " + str(i) + ";")
+            lines.append("    reaction inner(c) {")
+            lines.append("        let y = c + x" + str(LOCALS - 1) + ";")
+            lines.append("        reaction leaf(d) { return d + y + x0; }")
+            lines.append("        return leaf;")
+            lines.append("    }")
+            lines.append("    if (x3 < x4) { x5 = x6; } else { x7 = x8; }")
+            lines.append("    repif (x1 < 10) { x1 = x1 + 1; }")
+            lines.append("    return inner;")
+            lines.append("}")
+        else:
+            lines.append("def r" + str(r) + "(a, b):")
+            lines.append("    x0 = a + b")
+            for i in range(1, LOCALS):
+                lines.append("    x" + str(i) + " = x" + str(i - 1) + " * b + " + str(i))
+            lines.append("    def inner(c):")
+            lines.append("        y = c + x" + str(LOCALS - 1))
+            lines.append("        def leaf(d): return d + y + x0")
+            lines.append("        return leaf")
+            lines.append("    if x3 < x4: x5 = x6")
+            lines.append("    else: x7 = x8")
+            lines.append("    while x1 < 10: x1 = x1 + 1")
+            lines.append("    return inner")
+    return "\n".join(lines) + "\n"
+
+
+# Python Benchmarker
+def bench(iters):
+    code = source("python")
+    min = float("inf")
+    sum = 0
+
+    for i in range(0, iters):
+        start = time.time()
+        compile(code, "<bench>", "exec")
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Per Reaction: " + str(min * 1000000 / REACTIONS) + "us")
+    pass
+
+
+# the Nucleus source is written out for the nucleus executable to compile
+if len(sys.argv) > 1:
+    with open(sys.argv[1], "w") as out:
+        out.write(source("nucleus"))
+    sys.exit(0)
+
+print("\n=> Python3")
+bench(10)
+print()
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+python3 $SCRIPT_DIR/dispatch.py
+node $SCRIPT_DIR/dispatch.js
+./nucleus.exe $SCRIPT_DIR/dispatch.nuc
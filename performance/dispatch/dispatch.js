@@ -0,0 +1,34 @@
+/** JavaScript dispatch loop spin */
+const spin = iters => {
+    let a = 0;
+    let b = 1;
+    for (let i = 0; i < iters; i++) {
+        a = b - a;
+        b = a - b;
+    }
+    return a;
+}
+
+/** JavaScript Benchaming method */
+const bench = iters => {
+    const ITERATIONS = 1000000;
+    let min = Infinity;
+    let sum = 0n;
+
+    for (let i = 0; i < iters; i++) {
+        const t_start = process.hrtime.bigint();
+        spin(ITERATIONS);
+        const t_duration = (process.hrtime.bigint() - t_start) / 1000n;
+
+        sum += t_duration;
+        if (t_duration < min) min = t_duration;
+    }
+
+    console.log(`Average: ${sum / BigInt(iters)}us`);
+    console.log(`Min: ${min}us`);
+    console.log(`Per Iteration: ${Number(min) * 1000 / ITERATIONS}ns`);
+}
+
+console.log('\n=> JavaScript');
+bench(10);
+console.log();
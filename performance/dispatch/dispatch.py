@@ -0,0 +1,36 @@
+import time
+
+# Python Implementation of the dispatch loop spin
+def spin(iters):
+    a = 0
+    b = 1
+    for i in range(0, iters):
+        a = b - a
+        b = a - b
+    return a
+
+
+# Python Benchmarker
+def bench(iters):
+    ITERATIONS = 1000000
+    min = float("inf")
+    sum = 0
+
+    for i in range(0, iters):
+        start = time.time()
+        spin(ITERATIONS)
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Per Iteration: " + str(min * 1000000000 / ITERATIONS) + "ns")
+    pass
+
+
+print("\n=> Python3")
+bench(10)
+print()
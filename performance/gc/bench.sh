@@ -0,0 +1,7 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+python3 $SCRIPT_DIR/gc.py
+node $SCRIPT_DIR/gc.js
+./nucleus.exe $SCRIPT_DIR/gc.nuc
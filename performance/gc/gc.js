@@ -0,0 +1,55 @@
+/** JavaScript node of the churned list */
+class Node {
+    constructor(value) {
+        this.value = value;
+        this.next = null;
+    }
+
+    get() {
+        return this.value;
+    }
+}
+
+/** JavaScript allocation churn */
+const churn = iters => {
+    const head = new Node(0);
+    let tail = head;
+    let s = 0;
+    for (let i = 0; i < iters; i++) {
+        const node = new Node(i);
+        const label = 'node' + i;
+        const get = node.get.bind(node);
+        s = s + get() + label.length * 0;
+
+        // keep every hundredth node alive
+        if (i % 100 === 0) {
+            tail.next = node;
+            tail = node;
+        }
+    }
+    return s;
+}
+
+/** JavaScript Benchaming method (collection pauses are not exposed synchronously) */
+const bench = iters => {
+    const ITERATIONS = 200000;
+    let min = Infinity;
+    let sum = 0n;
+
+    for (let i = 0; i < iters; i++) {
+        const t_start = process.hrtime.bigint();
+        churn(ITERATIONS);
+        const t_duration = (process.hrtime.bigint() - t_start) / 1000n;
+
+        sum += t_duration;
+        if (t_duration < min) min = t_duration;
+    }
+
+    console.log(`Average: ${sum / BigInt(iters)}us`);
+    console.log(`Min: ${min}us`);
+    console.log(`Throughput: ${ITERATIONS * 1000 / Number(min)} iterations/ms`);
+}
+
+console.log('\n=> JavaScript');
+bench(10);
+console.log();
@@ -0,0 +1,76 @@
+import gc
+import time
+
+
+# Python node of the churned list
+class Node:
+    def __init__(self, value):
+        self.value = value
+        self.next = None
+
+    def get(self):
+        return self.value
+
+
+# Python Implementation of the allocation churn
+def churn(iters):
+    head = Node(0)
+    tail = head
+    s = 0
+    for i in range(0, iters):
+        node = Node(i)
+        label = "node" + str(i)
+        get = node.get
+        s = s + get()
+
+        # keep every hundredth node alive
+        if i % 100 == 0:
+            tail.next = node
+            tail = node
+    return s
+
+
+# Python collection pause tracking
+pauses = {"start": 0, "total": 0, "max": 0, "count": 0}
+
+
+def track(phase, info):
+    if phase == "start":
+        pauses["start"] = time.perf_counter()
+    else:
+        pause = time.perf_counter() - pauses["start"]
+        pauses["total"] += pause
+        pauses["count"] += 1
+        if pause > pauses["max"]:
+            pauses["max"] = pause
+
+
+# Python Benchmarker
+def bench(iters):
+    ITERATIONS = 200000
+    min = float("inf")
+    sum = 0
+
+    gc.callbacks.append(track)
+    for i in range(0, iters):
+        start = time.time()
+        churn(ITERATIONS)
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+    gc.callbacks.remove(track)
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Throughput: " + str(ITERATIONS / (min * 1000)) + " iterations/ms")
+    print("Collections: " + str(pauses["count"]))
+    print("GC Time: " + str(pauses["total"] * 1000 / iters) + "ms per run")
+    print("Max Pause: " + str(pauses["max"] * 1000000) + "us")
+    pass
+
+
+print("\n=> Python3")
+bench(10)
+print()
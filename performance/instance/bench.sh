@@ -0,0 +1,7 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+python3 $SCRIPT_DIR/instance.py
+node $SCRIPT_DIR/instance.js
+./nucleus.exe $SCRIPT_DIR/instance.nuc
@@ -0,0 +1,45 @@
+/** JavaScript instance model */
+class Vec {
+    constructor(x, y, z) {
+        this.x = x;
+        this.y = y;
+        this.z = z;
+    }
+
+    dot(o) { return this.x * o.x + this.y * o.y + this.z * o.z; }
+}
+
+/** JavaScript instance spin */
+const spin = iters => {
+    const unit = new Vec(1, 1, 1);
+    let s = 0;
+    for (let i = 0; i < iters; i++) {
+        const v = new Vec(i, 2, 3);
+        s = s + v.dot(unit);
+    }
+    return s;
+}
+
+/** JavaScript Benchaming method */
+const bench = iters => {
+    const ITERATIONS = 1000000;
+    let min = Infinity;
+    let sum = 0n;
+
+    for (let i = 0; i < iters; i++) {
+        const t_start = process.hrtime.bigint();
+        spin(ITERATIONS);
+        const t_duration = (process.hrtime.bigint() - t_start) / 1000n;
+
+        sum += t_duration;
+        if (t_duration < min) min = t_duration;
+    }
+
+    console.log(`Average: ${sum / BigInt(iters)}us`);
+    console.log(`Min: ${min}us`);
+    console.log(`Per Instance: ${Number(min) * 1000 / ITERATIONS}ns`);
+}
+
+console.log('\n=> JavaScript');
+bench(5);
+console.log();
@@ -0,0 +1,48 @@
+import time
+
+
+# Python Implementation of the instance model
+class Vec:
+    def __init__(self, x, y, z):
+        self.x = x
+        self.y = y
+        self.z = z
+
+    def dot(self, o):
+        return self.x * o.x + self.y * o.y + self.z * o.z
+
+
+# Python Implementation of the instance spin
+def spin(iters):
+    unit = Vec(1, 1, 1)
+    s = 0
+    for i in range(0, iters):
+        v = Vec(i, 2, 3)
+        s = s + v.dot(unit)
+    return s
+
+
+# Python Benchmarker
+def bench(iters):
+    ITERATIONS = 1000000
+    min = float("inf")
+    sum = 0
+
+    for i in range(0, iters):
+        start = time.time()
+        spin(ITERATIONS)
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Per Instance: " + str(min * 1000000000 / ITERATIONS) + "ns")
+    pass
+
+
+print("\n=> Python3")
+bench(5)
+print()
@@ -0,0 +1,13 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+python3 $SCRIPT_DIR/lexer.py
+
+# the lexer is benchmarked on its own (without compiling), through a small C driver
+SOURCE=$(mktemp --suffix=.nuc)
+LEXER=$(mktemp)
+python3 $SCRIPT_DIR/lexer.py $SOURCE
+gcc -O2 $SCRIPT_DIR/lexer.c -o $LEXER
+$LEXER $SOURCE
+rm $SOURCE $LEXER
@@ -0,0 +1,74 @@
+// Nucleus lexer throughput (tokenizes a generated source without compiling it)
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Nucleus Headers
+#include "../../lib/compiler/lexer/lexer.h"
+
+/**
+ * Reads a whole file into memory.
+ * @param path                  Path of file.
+ * @param length                Pointer to store the file length to.
+ */
+static char* readFile(const char* path, size_t* length) {
+    FILE* file = fopen(path, "rb");
+    if (file == NULL) return NULL;
+
+    fseek(file, 0L, SEEK_END);
+    *length = ftell(file);
+    rewind(file);
+
+    char* buffer = (char*)malloc(*length + 1);
+    *length = fread(buffer, sizeof(char), *length, file);
+    buffer[*length] = '\0';
+    fclose(file);
+    return buffer;
+}
+
+/**
+ * Tokenizes a source until its end.
+ * @param source                Source to tokenize.
+ * @returns                     Number of tokens scanned.
+ */
+static long tokenize(const char* source) {
+    long tokens = 0;
+    lexer_init(source);
+    for (Token token = lexer_scan(); token.type != T_EOF; token = lexer_scan()) tokens++;
+    return tokens;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: lexer [path]\n");
+        return 1;
+    }
+
+    size_t length;
+    char* source = readFile(argv[1], &length);
+    if (source == NULL) {
+        fprintf(stderr, "Could not open \"%s\".\n", argv[1]);
+        return 1;
+    }
+
+    // benchmark the tokenizing
+    const int ITERATIONS = 10;
+    double min = 1e9, sum = 0;
+    long tokens = 0;
+    for (int i = 0; i < ITERATIONS; i++) {
+        clock_t start = clock();
+        tokens = tokenize(source);
+        double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC * 1000;  // in ms
+
+        sum += elapsed;
+        if (elapsed < min) min = elapsed;
+    }
+
+    printf("=> Nucleus\n");
+    printf("Average: %fms\n", sum / ITERATIONS);
+    printf("Min: %fms\n", min);
+    printf("Tokens: %ld\n", tokens);
+    printf("Throughput: %fMB/s\n\n", (length / (1024.0 * 1024.0)) / (min / 1000));
+    free(source);
+    return 0;
+}
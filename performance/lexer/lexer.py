@@ -0,0 +1,67 @@
+import io
+import sys
+import time
+import tokenize
+
+# Generates a large source of typical code (keywords, identifiers, literals and operators)
+BLOCKS = 20000
+
+
+def source(language):
+    lines = []
+    for b in range(0, BLOCKS):
+        if language == "nucleus":
+            lines.append("# block " + str(b))
+            lines.append("reaction update" + str(b) + "(vector, scale) {")
+            lines.append("    let total = 0;")
+            lines.append("    for (let index : 0, vector.length) {")
+            lines.append("        const value = vector[index] * scale + " + str(b) + ".5;")
+            lines.append("        if (value >= 100 && value != null) { total = total + value; } else { total = total - 1; }")
+            lines.append("    }")
+            lines.append("    repif (total > 1000) { total = total / 2; }")
+            lines.append("    return total == true || std.print(\"update\", total);")
+            lines.append("}")
+        else:
+            lines.append("# block " + str(b))
+            lines.append("def update" + str(b) + "(vector, scale):")
+            lines.append("    total = 0")
+            lines.append("    for index in range(0, len(vector)):")
+            lines.append("        value = vector[index] * scale + " + str(b) + ".5")
+            lines.append("        if value >= 100 and value != None: total = total + value")
+            lines.append("        else: total = total - 1")
+            lines.append("    while total > 1000: total = total / 2")
+            lines.append("    return total == True or print(\"update\", total)")
+    return "\n".join(lines) + "\n"
+
+
+# Python Benchmarker
+def bench(iters):
+    code = source("python")
+    min = float("inf")
+    sum = 0
+
+    for i in range(0, iters):
+        start = time.time()
+        for token in tokenize.generate_tokens(io.StringIO(code).readline):
+            pass
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Throughput: " + str((len(code) / (1024 * 1024)) / min) + "MB/s")
+    pass
+
+
+# the Nucleus source is written out for the lexer benchmark to tokenize
+if len(sys.argv) > 1:
+    with open(sys.argv[1], "w") as out:
+        out.write(source("nucleus"))
+    sys.exit(0)
+
+print("\n=> Python3")
+bench(3)  # tokenize is slow, so fewer iterations
+print()
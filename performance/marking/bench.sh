@@ -0,0 +1,7 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+# the marking workers are measured against each other (as there is nothing comparable to configure
+# for python / node)
+./nucleus.exe $SCRIPT_DIR/marking.nuc
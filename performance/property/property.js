@@ -0,0 +1,45 @@
+/** JavaScript property model */
+class Point {
+    constructor() {
+        this.x = 1;
+        this.y = 2;
+        this.z = 3;
+        this.w = 4;
+    }
+
+    sum() { return this.x + this.w; }
+}
+
+/** JavaScript property spin */
+const spin = (p, iters) => {
+    let s = 0;
+    for (let i = 0; i < iters; i++) {
+        s = s + p.y + p.z + p.sum();
+    }
+    return s;
+}
+
+/** JavaScript Benchaming method */
+const bench = iters => {
+    const ITERATIONS = 1000000;
+    const p = new Point();
+    let min = Infinity;
+    let sum = 0n;
+
+    for (let i = 0; i < iters; i++) {
+        const t_start = process.hrtime.bigint();
+        spin(p, ITERATIONS);
+        const t_duration = (process.hrtime.bigint() - t_start) / 1000n;
+
+        sum += t_duration;
+        if (t_duration < min) min = t_duration;
+    }
+
+    console.log(`Average: ${sum / BigInt(iters)}us`);
+    console.log(`Min: ${min}us`);
+    console.log(`Per Iteration: ${Number(min) * 1000 / ITERATIONS}ns`);
+}
+
+console.log('\n=> JavaScript');
+bench(10);
+console.log();
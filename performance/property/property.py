@@ -0,0 +1,48 @@
+import time
+
+
+# Python Implementation of the property model
+class Point:
+    def __init__(self):
+        self.x = 1
+        self.y = 2
+        self.z = 3
+        self.w = 4
+
+    def sum(self):
+        return self.x + self.w
+
+
+# Python Implementation of the property spin
+def spin(p, iters):
+    s = 0
+    for i in range(0, iters):
+        s = s + p.y + p.z + p.sum()
+    return s
+
+
+# Python Benchmarker
+def bench(iters):
+    ITERATIONS = 1000000
+    p = Point()
+    min = float("inf")
+    sum = 0
+
+    for i in range(0, iters):
+        start = time.time()
+        spin(p, ITERATIONS)
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Per Iteration: " + str(min * 1000000000 / ITERATIONS) + "ns")
+    pass
+
+
+print("\n=> Python3")
+bench(10)
+print()
@@ -0,0 +1,7 @@
+#!/bin/bash
+
+SCRIPT_DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" /dev/null && pwd )"
+
+python3 $SCRIPT_DIR/strings.py
+node $SCRIPT_DIR/strings.js
+./nucleus.exe $SCRIPT_DIR/strings.nuc
@@ -0,0 +1,32 @@
+/** JavaScript string builder */
+const build = iters => {
+    let s = '';
+    for (let i = 0; i < iters; i++) {
+        s = s + 'x' + i;
+    }
+    return s < '';
+}
+
+/** JavaScript Benchaming method */
+const bench = iters => {
+    const ITERATIONS = 20000;
+    let min = Infinity;
+    let sum = 0n;
+
+    for (let i = 0; i < iters; i++) {
+        const t_start = process.hrtime.bigint();
+        build(ITERATIONS);
+        const t_duration = (process.hrtime.bigint() - t_start) / 1000n;
+
+        sum += t_duration;
+        if (t_duration < min) min = t_duration;
+    }
+
+    console.log(`Average: ${sum / BigInt(iters)}us`);
+    console.log(`Min: ${min}us`);
+    console.log(`Per Iteration: ${Number(min) * 1000 / ITERATIONS}ns`);
+}
+
+console.log('\n=> JavaScript');
+bench(10);
+console.log();
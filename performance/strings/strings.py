@@ -0,0 +1,35 @@
+import time
+
+
+# Python Implementation of the string builder
+def build(iters):
+    s = ""
+    for i in range(0, iters):
+        s = s + "x" + str(i)
+    return s < ""
+
+
+# Python Benchmarker
+def bench(iters):
+    ITERATIONS = 20000
+    min = float("inf")
+    sum = 0
+
+    for i in range(0, iters):
+        start = time.time()
+        build(ITERATIONS)
+        elapsed = time.time() - start  # this is in seconds
+
+        sum = sum + elapsed
+        if elapsed < min:
+            min = elapsed
+
+    print("Average: " + str((sum / iters) * 1000) + "ms")
+    print("Min: " + str(min * 1000) + "ms")
+    print("Per Iteration: " + str(min * 1000000000 / ITERATIONS) + "ns")
+    pass
+
+
+print("\n=> Python3")
+bench(10)
+print()